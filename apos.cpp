@@ -1,26 +1,30 @@
 #include "apos.hpp"
 
+#include <cmath>
+
 namespace apparent_sun_moon {
 
 // 定数
 static constexpr unsigned long int kC = 299792458;      // 光速 (m/s)
 static constexpr unsigned int kDaySec = 86400;          // 1日の秒数(s)
 static constexpr double           kPi = atan(1.0) * 4;  // 円周率
+static constexpr unsigned int kBodies[3] = {3, 10, 11};  // 天体番号（地球, 月, 太陽）
 
 /*
  * @brief      コンストラクタ
  *
  * @param[in]  UTC (timespec)
  */
-Apos::Apos(struct timespec ts) {
+Apos::Apos(struct timespec ts) : o_jpl(0.0), lt_g(0.0), lt(0.0) {
+  struct timespec ts_tdb;
+  double          jd_1;
+  double          jd_2;
+  double          jcn;
+
   try {
-    this->utc = ts;
-    Time t_utc(utc);
-    this->tdb = t_utc.calc_tdb();
-    Time t_tdb(tdb);
-    this->jd  = t_tdb.calc_jd();
-    this->jcn = t_tdb.calc_t();
-    calc_val_t2();  // 時刻 t2(TDB) における各種値の計算
+    // UTC -> TDB, JD（2分割）, T
+    Time::calc_tdb_batch(1, &ts, &jd_1, &jd_2, &jcn, &ts_tdb);
+    set_t2(ts, ts_tdb, jd_1, jd_2, jcn);
   } catch (...) {
     throw;
   }
@@ -33,46 +37,12 @@ Apos::Apos(struct timespec ts) {
  * @return  視位置 (Position)
  */
 Position Apos::sun() {
-  double   t1_jd;
-  Coord    v_21;         // 地球重心(t2)から太陽(t1)への方向ベクトル
-  Coord    v_dd;         // 光行差補正後ベクトル
-  Coord    pos_sun;      // 太陽位置（直交座標）
-  Coord    pos_sun_bpn;  // 太陽位置（直交座標）（バイアス・歳差・章動適用後）
-  Coord    eq_pol;       // 赤道極座標
-  Coord    ec_rect;      // 黄道直交座標
-  Coord    ec_pol;       // 黄道極座標
   Position pos;
 
   try {
-    // === 太陽が光を発した時刻 t1(JD) の計算
-    t1_jd = calc_t1(11);
-    // === 時刻 t1 における各種値の計算
-    calc_val_t1(t1_jd);
-    // === 時刻 t2 における地球重心から時刻 t1 における太陽への方向ベクトルの計算
-    v_21 = calc_unit_vector(p_e[1], p_s[0]);
-    // === GCRS 座標系: 光行差の補正（方向ベクトルの Lorentz 変換）
-    v_dd = conv_lorentz(v_21);
-    pos_sun = calc_pos(v_dd, d_e_s);
-    // === 瞬時の真座標系: GCRS への バイアス・歳差・章動の適用
     Bpn o_bpn(jcn);
-    pos_sun_bpn = o_bpn.apply_bias_prec_nut(pos_sun);
-    // === 黄道傾斜角
-    Obliquity o_ob;
-    eps = o_ob.calc_ob(jcn);
-    //# === 座標変換
-    Convert o_cv(eps);
-    eq_pol  = o_cv.rect2pol(pos_sun_bpn);
-    ec_rect = o_cv.rect_eq2ec(pos_sun_bpn);
-    ec_pol  = o_cv.rect2pol(ec_rect);
-    pos.alpha  = eq_pol.x;
-    pos.delta  = eq_pol.y;
-    pos.d_eq   = eq_pol.z;
-    pos.lambda = ec_pol.x;
-    pos.beta   = ec_pol.y;
-    pos.d_ec   = ec_pol.z;
-    // === 視半径／（地平）視差計算
-    pos.a_radius = asin(r_s / (eq_pol.z * au)) * 180.0 / kPi * 3600.0;
-    pos.parallax = asin(r_e / (eq_pol.z * au)) * 180.0 / kPi * 3600.0;
+    Convert o_cv(calc_eps());
+    pos = calc_apos(11, o_bpn, o_cv);
   } catch (...) {
     throw;
   }
@@ -87,36 +57,205 @@ Position Apos::sun() {
  * @return  視位置 (Position)
  */
 Position Apos::moon() {
-  double   t1_jd;
-  Coord    v_21;          // 地球重心(t2)から太陽(t1)への方向ベクトル
-  Coord    v_dd;          // 光行差補正後ベクトル
-  Coord    pos_moon;      // 月位置（直交座標）
-  Coord    pos_moon_bpn;  // 月位置（直交座標）（バイアス・歳差・章動適用後）
-  Coord    eq_pol;        // 赤道極座標
-  Coord    ec_rect;       // 黄道直交座標
-  Coord    ec_pol;        // 黄道極座標
   Position pos;
 
   try {
-    // === 月が光を発した時刻 t1(JD) の計算
-    t1_jd = calc_t1(10);
+    Bpn o_bpn(jcn);
+    Convert o_cv(calc_eps());
+    pos = calc_apos(10, o_bpn, o_cv);
+  } catch (...) {
+    throw;
+  }
+
+  return pos;
+}
+
+/*
+ * @brief       視位置計算: 太陽・月（一括）
+ *              * バイアス・歳差・章動、黄道傾斜角、座標変換の準備は
+ *                同一時刻のため1回のみ行い、太陽・月で共有する
+ *
+ * @param[ref]  視位置: 太陽 (Position)
+ * @param[ref]  視位置: 月 (Position)
+ * @return      <none>
+ */
+void Apos::sun_moon(Position& pos_s, Position& pos_m) {
+  try {
+    Bpn o_bpn(jcn);
+    Convert o_cv(calc_eps());
+    pos_s = calc_apos(11, o_bpn, o_cv);
+    pos_m = calc_apos(10, o_bpn, o_cv);
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief      視位置計算: 時系列
+ *             * 開始時刻から一定間隔の各時刻について、指定天体の視位置を計算
+ *             * 時刻系の変換は一括で行い（Time::calc_tdb_batch）、
+ *               暦の係数レコード（Jpl; レコード変更時のみ読み込み）は
+ *               全時刻で共有する
+ *             * 光行時間の反復は、直前2時刻の光行時間からの外挿値を
+ *               初期値とする（収束条件は単独の計算と同じ）
+ *             * バイアス・歳差・章動の回転行列は BpnCache の設定
+ *               （Bpn の生成時に適用）に従って再利用される
+ *
+ * @param[in]  開始時刻 (timespec; UTC)
+ * @param[in]  間隔 (timespec; 0 <= tv_nsec < 1e9, 負値不可)
+ * @param[in]  件数 (unsigned int)
+ * @param[in]  天体番号一覧 (vector<unsigned int>; 10: 月, 11: 太陽)
+ * @return     視位置 (vector<vector<Position>>; [天体][時刻])
+ */
+std::vector<std::vector<Position>> Apos::series(
+    struct timespec utc_s, struct timespec step, unsigned int n,
+    const std::vector<unsigned int>& bodies) {
+  std::size_t n_b = bodies.size();  // 天体数
+  std::vector<std::vector<Position>> pos(n_b, std::vector<Position>(n));
+  std::vector<struct timespec> utcs(n);   // UTC 一覧
+  std::vector<struct timespec> tdbs(n);   // TDB 一覧
+  std::vector<double> jd_1s(n);           // JD 一覧（日数部）
+  std::vector<double> jd_2s(n);           // JD 一覧（日の端数）
+  std::vector<double> jcns(n);            // T 一覧
+  std::vector<double> lts(n_b * 2, 0.0);  // 光行時間（天体毎に直前2時刻分）
+  long         ns;                        // 開始時刻からのナノ秒（1秒未満）
+  unsigned int k;
+  std::size_t  b;
+
+  try {
+    for (b = 0; b < n_b; ++b) {
+      if (bodies[b] != 10 && bodies[b] != 11) {
+        throw "[ERROR] Invalid astro number!";
+      }
+    }
+    if (step.tv_sec < 0 || step.tv_nsec < 0 || step.tv_nsec >= 1000000000L) {
+      throw "[ERROR] Invalid step!";
+    }
+    if (n == 0) { return pos; }
+
+    // 時刻系の変換（一括）
+    for (k = 0; k < n; ++k) {
+      ns = utc_s.tv_nsec + k * step.tv_nsec;
+      utcs[k].tv_sec  = utc_s.tv_sec + k * step.tv_sec + ns / 1000000000L;
+      utcs[k].tv_nsec = ns % 1000000000L;
+    }
+    Time::calc_tdb_batch(n, utcs.data(), jd_1s.data(), jd_2s.data(),
+                         jcns.data(), tdbs.data());
+
+    // 視位置計算（暦・光行時間を時刻間で共有）
+    Apos o_a;
+    for (k = 0; k < n; ++k) {
+      o_a.set_t2(utcs[k], tdbs[k], jd_1s[k], jd_2s[k], jcns[k]);
+      Bpn o_bpn(o_a.jcn);
+      Convert o_cv(o_a.calc_eps());
+      for (b = 0; b < n_b; ++b) {
+        o_a.lt_g = (k >= 2) ? 2.0 * lts[b * 2 + 1] - lts[b * 2]
+                 : (k == 1) ? lts[b * 2 + 1] : 0.0;
+        pos[b][k] = o_a.calc_apos(bodies[b], o_bpn, o_cv);
+        lts[b * 2]     = lts[b * 2 + 1];
+        lts[b * 2 + 1] = o_a.lt;
+      }
+    }
+  } catch (...) {
+    throw;
+  }
+
+  return pos;
+}
+
+// -------------------------------------
+// 以下、 private functions
+// -------------------------------------
+//
+
+/*
+ * @brief      コンストラクタ（時刻未設定; series 用）
+ *             * 使用前に set_t2 で時刻を設定すること
+ */
+Apos::Apos() : o_jpl(0.0), lt_g(0.0), lt(0.0) {}
+
+/*
+ * @brief      設定: 時刻 t2
+ *             * 時刻 t2(TDB) における各種値を計算
+ *               （暦の係数レコードはレコード変更時のみ読み込み）
+ *
+ * @param[in]  UTC (timespec)
+ * @param[in]  TDB (timespec)
+ * @param[in]  JD の日数部 (double; TDB)
+ * @param[in]  JD の日の端数 (double; TDB)
+ * @param[in]  T (double; TDB)
+ * @return     <none>
+ */
+void Apos::set_t2(struct timespec utc, struct timespec tdb,
+                  double jd_1, double jd_2, double jcn) {
+  try {
+    this->utc  = utc;
+    this->tdb  = tdb;
+    this->jd_1 = jd_1;
+    this->jd_2 = jd_2;
+    this->jd   = jd_1 + jd_2;
+    this->jcn  = jcn;
+    calc_val_t2();  // 時刻 t2(TDB) における各種値の計算
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief   黄道傾斜角の計算
+ *
+ * @param   <none>
+ * @return  黄道傾斜角 (double)
+ */
+double Apos::calc_eps() {
+  try {
+    Obliquity o_ob;
+    eps = o_ob.calc_ob(jcn);
+  } catch (...) {
+    throw;
+  }
+
+  return eps;
+}
+
+/*
+ * @brief       視位置計算（太陽・月用）
+ *
+ * @param[in]   天体番号 (unsigned int; 10: 月, 11: 太陽)
+ * @param[ref]  バイアス・歳差・章動 (Bpn)
+ * @param[ref]  座標変換 (Convert)
+ * @return      視位置 (Position)
+ */
+Position Apos::calc_apos(unsigned int target, Bpn& o_bpn, Convert& o_cv) {
+  double   t1_jd;    // 時刻 t1（JD の日数部 jd_1 からの日数）
+  Coord    v_21;     // 地球重心(t2)から天体(t1)への方向ベクトル
+  Coord    v_dd;     // 光行差補正後ベクトル
+  Coord    pos_r;    // 天体位置（直交座標）
+  Coord    pos_bpn;  // 天体位置（直交座標）（バイアス・歳差・章動適用後）
+  Coord    eq_pol;   // 赤道極座標
+  Coord    ec_rect;  // 黄道直交座標
+  Coord    ec_pol;   // 黄道極座標
+  Position pos;
+
+  try {
+    // === 天体が光を発した時刻 t1(JD) の計算
+    t1_jd = calc_t1(target);
     // === 時刻 t1 における各種値の計算
     calc_val_t1(t1_jd);
-    // === 時刻 t2 における地球重心から時刻 t1 における月への方向ベクトルの計算
-    v_21 = calc_unit_vector(p_e[1], p_m[0]);
+    // === 時刻 t2 における地球重心から時刻 t1 における天体への方向ベクトルの計算
+    if (target == 10) {
+      v_21 = calc_unit_vector(p_e[1], p_m[0]);
+    } else {
+      v_21 = calc_unit_vector(p_e[1], p_s[0]);
+    }
     // === GCRS 座標系: 光行差の補正（方向ベクトルの Lorentz 変換）
     v_dd = conv_lorentz(v_21);
-    pos_moon = calc_pos(v_dd, d_e_m);
+    pos_r = calc_pos(v_dd, (target == 10) ? d_e_m : d_e_s);
     // === 瞬時の真座標系: GCRS への バイアス・歳差・章動の適用
-    Bpn o_bpn(jcn);
-    pos_moon_bpn = o_bpn.apply_bias_prec_nut(pos_moon);
-    // === 黄道傾斜角
-    Obliquity o_ob;
-    eps = o_ob.calc_ob(jcn);
+    pos_bpn = o_bpn.apply_bias_prec_nut(pos_r);
     //# === 座標変換
-    Convert o_cv(eps);
-    eq_pol  = o_cv.rect2pol(pos_moon_bpn);
-    ec_rect = o_cv.rect_eq2ec(pos_moon_bpn);
+    eq_pol  = o_cv.rect2pol(pos_bpn);
+    ec_rect = o_cv.rect_eq2ec(pos_bpn);
     ec_pol  = o_cv.rect2pol(ec_rect);
     pos.alpha  = eq_pol.x;
     pos.delta  = eq_pol.y;
@@ -125,7 +264,8 @@ Position Apos::moon() {
     pos.beta   = ec_pol.y;
     pos.d_ec   = ec_pol.z;
     // === 視半径／（地平）視差計算
-    pos.a_radius = asin(r_m / (eq_pol.z * au)) * 180.0 / kPi * 3600.0;
+    pos.a_radius = asin(((target == 10) ? r_m : r_s) / (eq_pol.z * au))
+                 * 180.0 / kPi * 3600.0;
     pos.parallax = asin(r_e / (eq_pol.z * au)) * 180.0 / kPi * 3600.0;
   } catch (...) {
     throw;
@@ -134,11 +274,6 @@ Position Apos::moon() {
   return pos;
 }
 
-// -------------------------------------
-// 以下、 private functions
-// -------------------------------------
-//
-
 /*
  * @brief   時刻 t2 におけるの各種値の計算
  *          (3:地球, 10:月, 11:太陽)
@@ -148,42 +283,28 @@ Position Apos::moon() {
  * @return  <none>
  */
 void Apos::calc_val_t2() {
+  double ps[3][3];  // 位置（地球, 月, 太陽）
+  double vs[3][3];  // 速度（地球, 月, 太陽）
+
   try {
     // バイナリファイル読み込み
-    Jpl o_jpl(jd);
-    o_jpl.read_bin();
-    au = o_jpl.au;
-    // ICRS 座標(3: 地球)
-    o_jpl.calc_pv(3, 12);
-    p_e[1].x = o_jpl.pos[0];
-    p_e[1].y = o_jpl.pos[1];
-    p_e[1].z = o_jpl.pos[2];
-    v_e[1].x = o_jpl.vel[0];
-    v_e[1].y = o_jpl.vel[1];
-    v_e[1].z = o_jpl.vel[2];
-    // ICRS 座標(10: 月)
-    o_jpl.calc_pv(10, 12);
-    p_m[1].x = o_jpl.pos[0];
-    p_m[1].y = o_jpl.pos[1];
-    p_m[1].z = o_jpl.pos[2];
-    v_m[1].x = o_jpl.vel[0];
-    v_m[1].y = o_jpl.vel[1];
-    v_m[1].z = o_jpl.vel[2];
-    // ICRS 座標(11: 太陽)
-    o_jpl.calc_pv(11, 12);
-    p_s[1].x = o_jpl.pos[0];
-    p_s[1].y = o_jpl.pos[1];
-    p_s[1].z = o_jpl.pos[2];
-    v_s[1].x = o_jpl.vel[0];
-    v_s[1].y = o_jpl.vel[1];
-    v_s[1].z = o_jpl.vel[2];
+    o_jpl.set_jd(jd_1, jd_2);
+    au = o_jpl.hdr.au;
+    // ICRS 座標(3: 地球, 10: 月, 11: 太陽)
+    o_jpl.calc_pvs(3, kBodies, 12, ps, vs);
+    set_coord(ps[0], p_e[1]);
+    set_coord(vs[0], v_e[1]);
+    set_coord(ps[1], p_m[1]);
+    set_coord(vs[1], v_m[1]);
+    set_coord(ps[2], p_s[1]);
+    set_coord(vs[2], v_s[1]);
     // 時刻 t2 における地球と太陽・月の距離
     d_e_s = calc_dist(p_e[1], p_s[1]);
     d_e_m = calc_dist(p_e[1], p_m[1]);
     // 太陽／月／地球の半径取得
-    r_s = get_cval(o_jpl.cnams, o_jpl.cvals, "ASUN");
-    r_m = get_cval(o_jpl.cnams, o_jpl.cvals, "AM");
-    r_e = get_cval(o_jpl.cnams, o_jpl.cvals, "RE");
+    r_s = o_jpl.hdr.get_cval("ASUN");
+    r_m = o_jpl.hdr.get_cval("AM");
+    r_e = o_jpl.hdr.get_cval("RE");
   } catch (...) {
     throw;
   }
@@ -194,43 +315,41 @@ void Apos::calc_val_t2() {
  *             (3:地球, 10:月, 11:太陽)
  *             (天体番号 12: 太陽系重心)
  *
- * @param[in]  Julian Day (double)
+ * @param[in]  時刻 t1 (double; JD の日数部 jd_1 からの日数)
  * @return     <none>
  */
 void Apos::calc_val_t1(double t1) {
+  double ps[3][3];  // 位置（地球, 月, 太陽）
+  double vs[3][3];  // 速度（地球, 月, 太陽）
+
   try {
-    // バイナリファイル読み込み
-    Jpl o_jpl(t1);
-    o_jpl.read_bin();
-    // ICRS 座標(3: 地球)
-    o_jpl.calc_pv(3, 12);
-    p_e[0].x = o_jpl.pos[0];
-    p_e[0].y = o_jpl.pos[1];
-    p_e[0].z = o_jpl.pos[2];
-    v_e[0].x = o_jpl.vel[0];
-    v_e[0].y = o_jpl.vel[1];
-    v_e[0].z = o_jpl.vel[2];
-    // ICRS 座標(10: 月)
-    o_jpl.calc_pv(10, 12);
-    p_m[0].x = o_jpl.pos[0];
-    p_m[0].y = o_jpl.pos[1];
-    p_m[0].z = o_jpl.pos[2];
-    v_m[0].x = o_jpl.vel[0];
-    v_m[0].y = o_jpl.vel[1];
-    v_m[0].z = o_jpl.vel[2];
-    // ICRS 座標(11: 太陽)
-    o_jpl.calc_pv(11, 12);
-    p_s[0].x = o_jpl.pos[0];
-    p_s[0].y = o_jpl.pos[1];
-    p_s[0].z = o_jpl.pos[2];
-    v_s[0].x = o_jpl.vel[0];
-    v_s[0].y = o_jpl.vel[1];
-    v_s[0].z = o_jpl.vel[2];
+    // バイナリファイル読み込み（t2 と同一レコードなら再読み込みなし）
+    o_jpl.set_jd(jd_1, t1);
+    // ICRS 座標(3: 地球, 10: 月, 11: 太陽)
+    o_jpl.calc_pvs(3, kBodies, 12, ps, vs);
+    set_coord(ps[0], p_e[0]);
+    set_coord(vs[0], v_e[0]);
+    set_coord(ps[1], p_m[0]);
+    set_coord(vs[1], v_m[0]);
+    set_coord(ps[2], p_s[0]);
+    set_coord(vs[2], v_s[0]);
   } catch (...) {
     throw;
   }
 }
 
+/*
+ * @brief       配列 -> Coord
+ *
+ * @param[in]   値 (double[3])
+ * @param[ref]  座標 (Coord)
+ */
+void Apos::set_coord(const double(&src)[3], Coord& dst) {
+  dst.x = src[0];
+  dst.y = src[1];
+  dst.z = src[2];
+}
+
 /*
  * @brief      2天体感の距離計算
  *
@@ -252,41 +371,17 @@ double Apos::calc_dist(Coord p_1, Coord p_2) {
   return d;
 }
 
-/*
- * @brief       CVAL 取得
- *
- * @param[ref]  CNAM 一覧 (vector<string>)
- * @param[ref]  CVAL 一覧 (vector<double>)
- * @param[in]   対象 CNAM (string)
- * @return      対象 CVAL (double)
- */
-double Apos::get_cval(
-    std::vector<std::string>& cnams, std::vector<double>& cvals,
-    std::string cnam) {
-  double cval;
-  unsigned int idx = 0;
-
-  try {
-    for (auto a: cnams) {
-      if (a == cnam) { break; }
-      ++idx;
-    }
-    cval = cvals[idx];
-  } catch (...) {
-    throw;
-  }
-
-  return cval;
-}
-
 /*
  * @brief       計算: 基準天体が光を発した時刻 t1（太陽・月用）
  *              * 計算式： c * (t2 - t1) = r12  (但し、 c: 光の速度。 Newton 法で近似）
  *              * 太陽・月専用なので、太陽・木星・土星・天王星・海王星の重力場による
  *                光の曲がりは非考慮。
  *
+ *              * 時刻は JD の日数部 jd_1 からの日数で扱う
+ *                （JD 全体では丸め誤差が数十μ秒となるため）
+ *
  * @param[in]   基準天体番号 (unsigned int)
- * @return      時刻(Julian Day) (timespec)
+ * @return      時刻 t1 (double; JD の日数部 jd_1 からの日数)
  */
 double Apos::calc_t1(unsigned int target) {
   double       t1;
@@ -300,7 +395,7 @@ double Apos::calc_t1(unsigned int target) {
   unsigned int m;
 
   try {
-    t1 = jd;
+    t1 = jd_2;
     t2 = t1;
     if (target == 10) {
       // 月
@@ -322,21 +417,33 @@ double Apos::calc_t1(unsigned int target) {
       // その他は、取り急ぎ 0.0 を返却
       return 0.0;
     }
+    // 光行時間の初期値がある場合は、その時刻から反復
+    if (lt_g > 0.0) {
+      t1 = t2 - lt_g;
+      o_jpl.set_jd(jd_1, t1);
+      o_jpl.calc_pv(target, 12);
+      p_1.x = o_jpl.pos[0];
+      p_1.y = o_jpl.pos[1];
+      p_1.z = o_jpl.pos[2];
+      v_1.x = o_jpl.vel[0];
+      v_1.y = o_jpl.vel[1];
+      v_1.z = o_jpl.vel[2];
+    }
     df = 1.0;
     m  = 0;
-    while (df > 1.0e-10) {
+    while (std::abs(df) > 1.0e-10) {
       r_12.x = p_1.x - p_e[1].x;
       r_12.y = p_1.y - p_e[1].y;
       r_12.z = p_1.z - p_e[1].z;
       d_12 = calc_dist(p_1, p_e[1]);
-      df = (kC * kDaySec / au) * (t2 - t1) - d_12;
+      // f(t1) = c (t2 - t1) - |r_12(t1)| = 0 （c: AU/day, au: km）
+      df = (kC * kDaySec / (au * 1000.0)) * (t2 - t1) - d_12;
       df_wk  = r_12.x * v_1.x + r_12.y * v_1.y + r_12.z * v_1.z;
       df /= (kC * kDaySec / (au * 1000.0)) + df_wk / d_12;
       t1 += df;
       ++m;
       if (m > 10) { throw "[ERROR] Newton method error!"; }
-      Jpl o_jpl(t1);
-      o_jpl.read_bin();
+      o_jpl.set_jd(jd_1, t1);
       o_jpl.calc_pv(target, 12);
       p_1.x = o_jpl.pos[0];
       p_1.y = o_jpl.pos[1];
@@ -345,6 +452,7 @@ double Apos::calc_t1(unsigned int target) {
       v_1.y = o_jpl.vel[1];
       v_1.z = o_jpl.vel[2];
     }
+    lt = t2 - t1;
   } catch (...) {
     throw;
   }
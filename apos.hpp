@@ -10,6 +10,7 @@
 
 #include <ctime>
 #include <iostream>  // for cout etc.
+#include <vector>
 
 namespace apparent_sun_moon {
 
@@ -35,23 +36,38 @@ class Apos {
   double r_m;           // 半径(月)
   double r_s;           // 半径(太陽)
   double eps;           // 黄道傾斜角
+  Jpl    o_jpl;         // 暦（t2, t1 の計算で共有; レコード変更時のみ読み込み）
+  double lt_g;          // 光行時間の初期値（日; 0.0: 初期値なし（t2 から反復））
+  double lt;            // 光行時間（日; 直近の calc_t1 の結果）
 
 public:
   struct timespec tdb;     // timespec of TDB (of t2)
   double          jd;      // Julian Day for TDB (of t2)
+  double          jd_1;    // Julian Day for TDB (of t2; 日数部 (0h; x.5))
+  double          jd_2;    // Julian Day for TDB (of t2; 日の端数)
 
   Apos(struct timespec);   // コンストラクタ
   Position sun();          // 視位置計算: 太陽
   Position moon();         // 視位置計算: 月
+  void     sun_moon(Position&, Position&);
+                           // 視位置計算: 太陽・月（一括）
+  static std::vector<std::vector<Position>> series(
+      struct timespec, struct timespec, unsigned int,
+      const std::vector<unsigned int>&);
+                           // 視位置計算: 時系列（開始, 間隔, 件数, 天体）
 
 private:
+  Apos();                           // コンストラクタ（時刻未設定; series 用）
+  void   set_t2(struct timespec, struct timespec, double, double, double);
+                                    // 設定: 時刻 t2（UTC, TDB, JD（2分割）, T）
+  double calc_eps();                // 計算: 黄道傾斜角
+  Position calc_apos(unsigned int, Bpn&, Convert&);
+                                    // 視位置計算（太陽・月用）
+  void   set_coord(const double(&)[3], Coord&);  // 配列 -> Coord
   double calc_dist(Coord, Coord);   // 2点体感の距離計算
-  double get_cval(
-             std::vector<std::string>&, std::vector<double>&,
-             std::string);          // CVAL 取得
   void   calc_val_t2();             // 計算: 時刻 t2 におけるの各種値
   void   calc_val_t1(double);       // 計算: 時刻 t1 におけるの各種値
-  double calc_t1(unsigned int);     // 計算: 基準天体が光を発した時刻(JD) t1（太陽・月用）
+  double calc_t1(unsigned int);     // 計算: 基準天体が光を発した時刻 t1（jd_1 からの日数; 太陽・月用）
   Coord  calc_unit_vector(Coord, Coord);
                                     // 計算: 天体Aから見た天体Bの方向ベクトル（太陽・月専用）
   Coord  conv_lorentz(Coord);       // 計算: GCRS 座標系: 光行差の補正(方向ベクトルの Lorentz 変換)
@@ -14,6 +14,7 @@
                  （先頭から、西暦年(4), 月(2), 日(2), 時(2), 分(2), 秒(2),
                              1秒未満(9)（小数点以下9桁（ナノ秒）まで））
                  無指定なら現在(システム日時)と判断。
+         * 日時の計算はタイムゾーン（TZ）に依存しない
 ***********************************************************/
 #include "apos.hpp"
 #include "position.hpp"
@@ -34,6 +35,7 @@ int main(int argc, char* argv[]) {
   struct timespec jst;  // JST
   struct timespec utc;  // UTC
   struct tm t = {};     // for work
+  ns::DateTime dt;      // JST（日時）
   ns::Position pos_s;   // 視位置（太陽）
   ns::Position pos_m;   // 視位置（月）
 
@@ -50,19 +52,26 @@ int main(int argc, char* argv[]) {
       s_nsec = s_tm - 14;
       std::istringstream is(tm_str);
       is >> std::get_time(&t, "%Y%m%d%H%M%S");
-      jst.tv_sec  = mktime(&t);
-      jst.tv_nsec = 0;
+      dt.year  = t.tm_year + 1900;
+      dt.month = t.tm_mon + 1;
+      dt.day   = t.tm_mday;
+      dt.hour  = t.tm_hour;
+      dt.min   = t.tm_min;
+      dt.sec   = t.tm_sec;
+      dt.nsec  = 0;
+      jst = ns::dt2ts(dt);
       if (s_tm > 14) {
         jst.tv_nsec = std::stod(
             tm_str.substr(14, s_nsec) + std::string(9 - s_nsec, '0'));
       }
     } else {
-      // 現在日時の取得
-      ret = std::timespec_get(&jst, TIME_UTC);
+      // 現在日時の取得（UTC -> JST）
+      ret = std::timespec_get(&utc, TIME_UTC);
       if (ret != 1) {
         std::cout << "[ERROR] Could not get now time!" << std::endl;
         return EXIT_FAILURE;
       }
+      jst = ns::utc2jst(utc);
     }
 
     // JST -> UTC
@@ -70,8 +79,7 @@ int main(int argc, char* argv[]) {
 
     // 視位置計算
     ns::Apos o_a(utc);
-    pos_s = o_a.sun();
-    pos_m = o_a.moon();
+    o_a.sun_moon(pos_s, pos_m);
 
     // 結果出力
     std::cout << "            JST: "
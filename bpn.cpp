@@ -1,5 +1,8 @@
 #include "bpn.hpp"
 
+#include "bpn_cache.hpp"
+#include "bpn_table.hpp"
+
 namespace apparent_sun_moon {
 
 // 定数
@@ -7,6 +10,13 @@ static constexpr double kPi    = atan(1.0) * 4;  // PI
 static constexpr double kPi2   = kPi * 2;        // PI * 2
 static constexpr double kAs2R  = kPi / (3600.0 * 180.0);  // arcseconds -> radians
 static constexpr double kMas2R = kAs2R / 1000.0;          // millarcsecond -> radian
+static constexpr Mtx3   kMtxBias
+  = r_z_c(78.0 * kMas2R, r_y_c(-17.3 * kMas2R, r_x_c(-5.1 * kMas2R)));
+                                                          // 回転行列（バイアス; コンパイル時に生成）
+
+// static メンバ変数の初期化
+const BpnTable* Bpn::tbl = nullptr;  // 章動・歳差パラメータの補間表
+std::atomic<unsigned long> Bpn::gen_tbl{0};  // 補間表の設定の世代
 
 /*
  * @brief      コンストラクタ
@@ -20,258 +30,125 @@ Bpn::Bpn(double jcn) {
     // 黄道傾斜角計算
     Obliquity o_ob;
     eps = o_ob.calc_ob(jcn);
-    // 回転行列生成
-    if (!gen_r_bias(         r_bias         )) throw;
-    if (!gen_r_bias_prec(    r_bias_prec    )) throw;
-    if (!gen_r_bias_prec_nut(r_bias_prec_nut)) throw;
-    if (!gen_r_prec(         r_prec         )) throw;
-    if (!gen_r_prec_nut(     r_prec_nut     )) throw;
-    if (!gen_r_nut(          r_nut          )) throw;
+    // 回転行列は使用時に生成（load_r）
+    flg_r  = 0;
+    is_nut = false;
+    is_tv  = false;
+    has_tv = false;
   } catch (...) {
     throw;
   }
 }
 
 /*
- * @brief      Bias 変換行列（一般的な理論）生成
- *
- *             赤道座標(J2000.0)の極は ICRS の極に対して12時（x軸のマイナス側）の方
- *             向へ 17.3±0.2 mas、18時（y軸のマイナス側）の方向へ 5.1±0.2 mas ズレ
- *             ているので、変換する。
- *             さらに、平均分点への変換はICRSでの赤経を78±10 mas、天の極を中心に回
- *             転させる。
- *               18時の方向の変換はx軸を-5.1mas回転（以下の A は回転量(rad)）
- *                         + 1     0      0   +
- *                 R1(A) = | 0   cosA   sinA  |
- *                         + 0  -sinA   cosA  +
- *               12時の方向の変換はy軸を-17.3mas回転
- *                         + cosA   0  -sinA  +
- *                 R2(A) = |   0    1     0   |
- *                         + sinA   0   cosA  +
- *               天の極を中心に78.0mas回転
- *                         +  cosA   sinA   0 +
- *                 R3(A) = | -sinA   cosA   0 |
- *                         +    0      0    1 +
+ * @brief      変換行列生成: バイアス
+ *             * 初回のみ計算（comp_r_bias）し、以降は生成済みの行列を返す
  *
  * @param[ref] 回転行列(double[3][3])
  * @return     true|false
  */
 bool Bpn::gen_r_bias(double(&r)[3][3]) {
-  double r_0[3][3];
-  double r_1[3][3];
+  unsigned int i;
+  unsigned int j;
 
-  try {
-    if (!r_x( -5.1 * kMas2R, r_0     )) throw;
-    if (!r_y(-17.3 * kMas2R, r_1, r_0)) throw;
-    if (!r_z( 78.0 * kMas2R, r  , r_1)) throw;
-  } catch (...) {
-    return false;
+  if (!load_r(kFlgBias)) { return false; }
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) { r[i][j] = r_bias[i][j]; }
   }
 
   return true;
 }
 
 /*
- * @brief      Bias + Precession 変換行列生成
- *
- *             IAU 2006 (Fukushima-Williams 4-angle formulation) 理論
+ * @brief      変換行列生成: バイアス＆歳差
+ *             * 初回のみ計算（comp_r_bias_prec）し、以降は生成済みの行列を返す
  *
  * @param[ref] 回転行列(double[3][3])
  * @return     true|false
  */
 bool Bpn::gen_r_bias_prec(double(&r)[3][3]) {
-  double gamma;
-  double phi;
-  double psi;
-  double r_0[3][3];
-  double r_1[3][3];
-  double r_2[3][3];
+  unsigned int i;
+  unsigned int j;
 
-  try {
-    gamma = comp_gamma_bp();
-    phi   = comp_phi_bp();
-    psi   = comp_psi_bp();
-    if (!r_z(gamma, r_0     )) throw;
-    if (!r_x(  phi, r_1, r_0)) throw;
-    if (!r_z( -psi, r_2, r_1)) throw;
-    if (!r_x( -eps, r  , r_2)) throw;
-  } catch (...) {
-    return false;
+  if (!load_r(kFlgBiasPrec)) { return false; }
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) { r[i][j] = r_bias_prec[i][j]; }
   }
 
   return true;
 }
 
 /*
- * @brief      Bias + Precession + Nutation 変換行列生成
- *
- *             IAU 2006 (Fukushima-Williams 4-angle formulation) 理論
+ * @brief      変換行列生成: バイアス＆歳差＆章動
+ *             * 初回のみ計算（comp_r_bias_prec_nut）し、以降は生成済みの行列を返す
  *
  * @param[ref] 回転行列(double[3][3])
  * @return     true|false
  */
 bool Bpn::gen_r_bias_prec_nut(double(&r)[3][3]) {
-  double gamma;
-  double phi;
-  double psi;
-  double fj2;
-  double dpsi;
-  double deps;
-  double r_0[3][3];
-  double r_1[3][3];
-  double r_2[3][3];
+  unsigned int i;
+  unsigned int j;
 
-  try {
-    // Nutation(delta-psi, delta-eps) 計算
-    Nutation o_n(jcn);
-    if (!o_n.calc_nutation(dpsi, deps)) {
-      std::cout << "[ERROR] Could not calculate delta-psi, "
-                << "delta-epsilon!" << std::endl;
-      return EXIT_FAILURE;
-    }
-    // 変換行列生成
-    gamma = comp_gamma_bp();
-    phi   = comp_phi_bp();
-    psi   = comp_psi_bp();
-    fj2 = -2.7774e-6 * jcn;
-    dpsi += dpsi * (0.4697e-6 + fj2);
-    deps += deps * fj2;
-    if (!r_z(    gamma, r_0     )) throw;
-    if (!r_x(      phi, r_1, r_0)) throw;
-    if (!r_z(-psi-dpsi, r_2, r_1)) throw;
-    if (!r_x(-eps-deps, r  , r_2)) throw;
-  } catch (...) {
-    return false;
+  if (!load_r(kFlgBiasPrecNut)) { return false; }
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) { r[i][j] = r_bias_prec_nut[i][j]; }
   }
 
   return true;
 }
 
 /*
- * @brief      precession（歳差）変換行列（J2000.0 用）生成
- *
- *            歳差の変換行列
- *              P(ε , ψ , φ , γ ) = R1(-ε ) * R3(-ψ ) * R1(φ ) * R3(γ )
- *            但し、R1, R2, R3 は x, y, z 軸の回転。
- *                       + 1     0       0   +            +  cosθ   sinθ   0 +
- *              R1(θ) = | 0   cosθ   sinθ | , R3(θ) = | -sinθ   cosθ   0 |
- *                       + 0  -sinθ   cosθ +            +    0       0     1 +
- *                                  + P_11 P_12 P_13 +
- *              P(ε, ψ, φ, γ) = | P_21 P_22 P_23 | とすると、
- *                                  + P_31 P_32 P_33 +
- *              P_11 = cosψ cosγ + sinψ cosφ sinγ
- *              P_12 = cosψ sinγ - sinψ cosφ ̄cosγ
- *              P_13 = -sinψ sinφ
- *              P_21 = cosε sinψ cosγ - (cosε cosψ cosφ + sinε sinφ )sinγ
- *              P_22 = cosε sinψ cosγ + (cosε cosψ cosφ + sinε sinφ )cosγ
- *              P_23 = cosε cosψ sinφ - sinε cosφ
- *              P_31 = sinε sinψ cosγ - (sinε cosψ cosφ - cosε sinφ)sinγ
- *              P_32 = sinε sinψ cosγ + (sinε cosψ cosφ - cosε sinφ)cosγ
- *              P_33 = sinε cosψ sinφ + cosε cosφ
+ * @brief      変換行列生成: 歳差
+ *             * 初回のみ計算（comp_r_prec）し、以降は生成済みの行列を返す
  *
  * @param[ref] 回転行列(double[3][3])
  * @return     true|false
  */
 bool Bpn::gen_r_prec(double(&r)[3][3]) {
-  double gamma;
-  double phi;
-  double psi;
-  double r_0[3][3];
-  double r_1[3][3];
-  double r_2[3][3];
+  unsigned int i;
+  unsigned int j;
 
-  try {
-    gamma = comp_gamma_p();
-    phi   = comp_phi_p();
-    psi   = comp_psi_p();
-    if (!r_z(gamma, r_0     )) throw;
-    if (!r_x(  phi, r_1, r_0)) throw;
-    if (!r_z( -psi, r_2, r_1)) throw;
-    if (!r_x( -eps, r  , r_2)) throw;
-  } catch (...) {
-    return false;
+  if (!load_r(kFlgPrec)) { return false; }
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) { r[i][j] = r_prec[i][j]; }
   }
 
   return true;
 }
 
 /*
- * @brief      Precession（歳差） & Nutation（章動） 変換行列生成
- *
- *             IAU 2000A nutation with adjustments to match the IAU 2006 precession.
+ * @brief      変換行列生成: 歳差＆章動
+ *             * 初回のみ計算（comp_r_prec_nut）し、以降は生成済みの行列を返す
  *
  * @param[ref] 回転行列(double[3][3])
  * @return     true|false
  */
 bool Bpn::gen_r_prec_nut(double(&r)[3][3]) {
-  double gamma;
-  double phi;
-  double psi;
-  double fj2;
-  double dpsi;
-  double deps;
-  double r_0[3][3];
-  double r_1[3][3];
-  double r_2[3][3];
+  unsigned int i;
+  unsigned int j;
 
-  try {
-    // Nutation(delta-psi, delta-eps) 計算
-    Nutation o_n(jcn);
-    if (!o_n.calc_nutation(dpsi, deps)) {
-      std::cout << "[ERROR] Could not calculate delta-psi, "
-                << "delta-epsilon!" << std::endl;
-      return EXIT_FAILURE;
-    }
-    // 変換行列生成
-    gamma = comp_gamma_p();
-    phi   = comp_phi_p();
-    psi   = comp_psi_p();
-    fj2 = -2.7774e-6 * jcn;
-    dpsi += dpsi * (0.4697e-6 + fj2);
-    deps += deps * fj2;
-    if (!r_z(    gamma, r_0     )) throw;
-    if (!r_x(      phi, r_1, r_0)) throw;
-    if (!r_z(-psi-dpsi, r_2, r_1)) throw;
-    if (!r_x(-eps-deps, r  , r_2)) throw;
-  } catch (...) {
-    return false;
+  if (!load_r(kFlgPrecNut)) { return false; }
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) { r[i][j] = r_prec_nut[i][j]; }
   }
 
   return true;
 }
 
 /*
- * @brief      nutation（章動）変換行列生成
- *
- *             IAU 2000A nutation with adjustments to match the IAU 2006 precession.
+ * @brief      変換行列生成: 章動
+ *             * 初回のみ計算（comp_r_nut）し、以降は生成済みの行列を返す
  *
  * @param[ref] 回転行列(double[3][3])
  * @return     true|false
  */
 bool Bpn::gen_r_nut(double(&r)[3][3]) {
-  double fj2;
-  double dpsi;
-  double deps;
-  double r_0[3][3];
-  double r_1[3][3];
+  unsigned int i;
+  unsigned int j;
 
-  try {
-    // Nutation(delta-psi, delta-eps) 計算
-    Nutation o_n(jcn);
-    if (!o_n.calc_nutation(dpsi, deps)) {
-      std::cout << "[ERROR] Could not calculate delta-psi, "
-                << "delta-epsilon!" << std::endl;
-      return EXIT_FAILURE;
-    }
-    // 変換行列生成
-    fj2 = -2.7774e-6 * jcn;
-    dpsi += dpsi * (0.4697e-6 + fj2);
-    deps += deps * fj2;
-    if (!r_x(      eps, r_0     )) throw;
-    if (!r_z(    -dpsi, r_1, r_0)) throw;
-    if (!r_x(-eps-deps, r  , r_1)) throw;
-  } catch (...) {
-    return false;
+  if (!load_r(kFlgNut)) { return false; }
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) { r[i][j] = r_nut[i][j]; }
   }
 
   return true;
@@ -287,6 +164,7 @@ Coord Bpn::apply_bias(Coord pos_src) {
   Coord pos_dst;  // x, y, z
 
   try {
+    if (!load_r(kFlgBias)) throw;
     pos_dst = rotate(pos_src, r_bias);
   } catch (...) {
     throw;
@@ -305,6 +183,7 @@ Coord Bpn::apply_bias_prec(Coord pos_src) {
   Coord pos_dst;  // x, y, z
 
   try {
+    if (!load_r(kFlgBiasPrec)) throw;
     pos_dst = rotate(pos_src, r_bias_prec);
   } catch (...) {
     throw;
@@ -323,6 +202,7 @@ Coord Bpn::apply_bias_prec_nut(Coord pos_src) {
   Coord pos_dst;  // x, y, z
 
   try {
+    if (!load_r(kFlgBiasPrecNut)) throw;
     pos_dst = rotate(pos_src, r_bias_prec_nut);
   } catch (...) {
     throw;
@@ -341,6 +221,7 @@ Coord Bpn::apply_prec(Coord pos_src) {
   Coord pos_dst;  // x, y, z
 
   try {
+    if (!load_r(kFlgPrec)) throw;
     pos_dst = rotate(pos_src, r_prec);
   } catch (...) {
     throw;
@@ -359,6 +240,7 @@ Coord Bpn::apply_prec_nut(Coord pos_src) {
   Coord pos_dst;  // x, y, z
 
   try {
+    if (!load_r(kFlgPrecNut)) throw;
     pos_dst = rotate(pos_src, r_prec_nut);
   } catch (...) {
     throw;
@@ -377,6 +259,7 @@ Coord Bpn::apply_nut(Coord pos_src) {
   Coord pos_dst;  // x, y, z
 
   try {
+    if (!load_r(kFlgNut)) throw;
     pos_dst = rotate(pos_src, r_nut);
   } catch (...) {
     throw;
@@ -389,6 +272,307 @@ Coord Bpn::apply_nut(Coord pos_src) {
 // 以下、 private functions
 // -------------------------------------
 
+/*
+ * @brief      回転行列の取得（未生成の場合のみ生成）
+ *             * バイアス＆歳差＆章動は、BpnCache が有効であればキャッシュから取得
+ *
+ * @param[in]  対象フラグ (unsigned int; kFlg*)
+ * @return     true|false
+ */
+bool Bpn::load_r(unsigned int flg) {
+  bool ret = true;
+
+  if (flg_r & flg) { return true; }
+  switch (flg) {
+    case kFlgBias:        ret = comp_r_bias(r_bias);                   break;
+    case kFlgBiasPrec:    ret = comp_r_bias_prec(r_bias_prec);         break;
+    case kFlgBiasPrecNut: ret = BpnCache::get(jcn, r_bias_prec_nut)
+                             || comp_r_bias_prec_nut(r_bias_prec_nut);
+                          break;
+    case kFlgPrec:        ret = comp_r_prec(r_prec);                   break;
+    case kFlgPrecNut:     ret = comp_r_prec_nut(r_prec_nut);           break;
+    case kFlgNut:         ret = comp_r_nut(r_nut);                     break;
+    default:              ret = false;
+  }
+  if (ret) { flg_r |= flg; }
+
+  return ret;
+}
+
+/*
+ * @brief      Nutation(delta-psi, delta-eps) 計算
+ *             * IAU 2006 歳差に合わせた補正を含む
+ *             * Bpn 毎に1回のみ計算し、章動を含む各行列で共有
+ *
+ * @return     true|false
+ */
+bool Bpn::comp_nut() {
+  double fj2;
+
+  if (is_nut) { return true; }
+  try {
+    if (load_tv()) {
+      dpsi = tv[0];
+      deps = tv[1];
+    } else {
+      Nutation o_n(jcn);
+      if (!o_n.calc_nutation(dpsi, deps)) {
+        std::cout << "[ERROR] Could not calculate delta-psi, "
+                  << "delta-epsilon!" << std::endl;
+        return false;
+      }
+    }
+    fj2 = -2.7774e-6 * jcn;
+    dpsi += dpsi * (0.4697e-6 + fj2);
+    deps += deps * fj2;
+  } catch (...) {
+    return false;
+  }
+  is_nut = true;
+
+  return true;
+}
+
+/*
+ * @brief      設定: 章動・歳差パラメータの補間表
+ *             * 設定後に生成する Bpn は、表の範囲内であれば
+ *               Δψ, Δε, γ, φ, ψ を表の補間値で計算する（範囲外は直接計算）
+ *             * 表は呼び出し元が所有し、使用中は破棄しないこと
+ *             * 表の精度は生成時の許容誤差（BpnTable::build）で保証する
+ *               （表の Δψ, Δε は生成時の Nutation の設定による値のため、
+ *                 Nutation の設定を変更した場合は表を生成し直すこと）
+ *
+ * @param[in]  補間表 (const BpnTable*; nullptr: 使用しない)
+ * @return     <none>
+ */
+void Bpn::set_table(const BpnTable* tbl) {
+  Bpn::tbl = tbl;
+  ++gen_tbl;
+}
+
+/*
+ * @brief      取得: 設定の世代
+ *             * 補間表（set_table）、章動（Nutation の各設定）の変更ごとに増加する
+ *               （いずれも単調増加のため、和で変更の有無を判定できる）
+ *
+ * @param      <none>
+ * @return     設定の世代 (unsigned long)
+ */
+unsigned long Bpn::get_gen() {
+  return gen_tbl + Nutation::get_gen();
+}
+
+/*
+ * @brief      Bias 変換行列（一般的な理論）生成
+ *
+ *             赤道座標(J2000.0)の極は ICRS の極に対して12時（x軸のマイナス側）の方
+ *             向へ 17.3±0.2 mas、18時（y軸のマイナス側）の方向へ 5.1±0.2 mas ズレ
+ *             ているので、変換する。
+ *             さらに、平均分点への変換はICRSでの赤経を78±10 mas、天の極を中心に回
+ *             転させる。
+ *               18時の方向の変換はx軸を-5.1mas回転（以下の A は回転量(rad)）
+ *                         + 1     0      0   +
+ *                 R1(A) = | 0   cosA   sinA  |
+ *                         + 0  -sinA   cosA  +
+ *               12時の方向の変換はy軸を-17.3mas回転
+ *                         + cosA   0  -sinA  +
+ *                 R2(A) = |   0    1     0   |
+ *                         + sinA   0   cosA  +
+ *               天の極を中心に78.0mas回転
+ *                         +  cosA   sinA   0 +
+ *                 R3(A) = | -sinA   cosA   0 |
+ *                         +    0      0    1 +
+ *
+ * @param[ref] 回転行列(double[3][3])
+ * @return     true|false
+ */
+bool Bpn::comp_r_bias(double(&r)[3][3]) {
+  unsigned int i;
+  unsigned int j;
+
+  for (i = 0; i < 3; ++i) {
+    for (j = 0; j < 3; ++j) { r[i][j] = kMtxBias.m[i][j]; }
+  }
+
+  return true;
+}
+
+/*
+ * @brief      Bias + Precession 変換行列生成
+ *
+ *             IAU 2006 (Fukushima-Williams 4-angle formulation) 理論
+ *
+ * @param[ref] 回転行列(double[3][3])
+ * @return     true|false
+ */
+bool Bpn::comp_r_bias_prec(double(&r)[3][3]) {
+  double gamma;
+  double phi;
+  double psi;
+
+  try {
+    comp_angles_bp(gamma, phi, psi);
+    if (!r_fw(gamma, phi, psi, eps, r)) throw;
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief      Bias + Precession + Nutation 変換行列生成
+ *
+ *             IAU 2006 (Fukushima-Williams 4-angle formulation) 理論
+ *
+ * @param[ref] 回転行列(double[3][3])
+ * @return     true|false
+ */
+bool Bpn::comp_r_bias_prec_nut(double(&r)[3][3]) {
+  double gamma;
+  double phi;
+  double psi;
+
+  try {
+    // Nutation(delta-psi, delta-eps) 計算（Bpn 毎に1回のみ）
+    if (!comp_nut()) throw;
+    // 変換行列生成
+    comp_angles_bp(gamma, phi, psi);
+    if (!r_fw(gamma, phi, psi + dpsi, eps + deps, r)) throw;
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief      precession（歳差）変換行列（J2000.0 用）生成
+ *
+ *            歳差の変換行列
+ *              P(ε , ψ , φ , γ ) = R1(-ε ) * R3(-ψ ) * R1(φ ) * R3(γ )
+ *            但し、R1, R2, R3 は x, y, z 軸の回転。
+ *                       + 1     0       0   +            +  cosθ   sinθ   0 +
+ *              R1(θ) = | 0   cosθ   sinθ | , R3(θ) = | -sinθ   cosθ   0 |
+ *                       + 0  -sinθ   cosθ +            +    0       0     1 +
+ *                                  + P_11 P_12 P_13 +
+ *              P(ε, ψ, φ, γ) = | P_21 P_22 P_23 | とすると、
+ *                                  + P_31 P_32 P_33 +
+ *              P_11 = cosψ cosγ + sinψ cosφ sinγ
+ *              P_12 = cosψ sinγ - sinψ cosφ ̄cosγ
+ *              P_13 = -sinψ sinφ
+ *              P_21 = cosε sinψ cosγ - (cosε cosψ cosφ + sinε sinφ )sinγ
+ *              P_22 = cosε sinψ cosγ + (cosε cosψ cosφ + sinε sinφ )cosγ
+ *              P_23 = cosε cosψ sinφ - sinε cosφ
+ *              P_31 = sinε sinψ cosγ - (sinε cosψ cosφ - cosε sinφ)sinγ
+ *              P_32 = sinε sinψ cosγ + (sinε cosψ cosφ - cosε sinφ)cosγ
+ *              P_33 = sinε cosψ sinφ + cosε cosφ
+ *
+ * @param[ref] 回転行列(double[3][3])
+ * @return     true|false
+ */
+bool Bpn::comp_r_prec(double(&r)[3][3]) {
+  double gamma;
+  double phi;
+  double psi;
+
+  try {
+    gamma = comp_gamma_p();
+    phi   = comp_phi_p();
+    psi   = comp_psi_p();
+    if (!r_fw(gamma, phi, psi, eps, r)) throw;
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief      Precession（歳差） & Nutation（章動） 変換行列生成
+ *
+ *             IAU 2000A nutation with adjustments to match the IAU 2006 precession.
+ *
+ * @param[ref] 回転行列(double[3][3])
+ * @return     true|false
+ */
+bool Bpn::comp_r_prec_nut(double(&r)[3][3]) {
+  double gamma;
+  double phi;
+  double psi;
+
+  try {
+    // Nutation(delta-psi, delta-eps) 計算（Bpn 毎に1回のみ）
+    if (!comp_nut()) throw;
+    // 変換行列生成
+    gamma = comp_gamma_p();
+    phi   = comp_phi_p();
+    psi   = comp_psi_p();
+    if (!r_fw(gamma, phi, psi + dpsi, eps + deps, r)) throw;
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief      nutation（章動）変換行列生成
+ *
+ *             IAU 2000A nutation with adjustments to match the IAU 2006 precession.
+ *
+ * @param[ref] 回転行列(double[3][3])
+ * @return     true|false
+ */
+bool Bpn::comp_r_nut(double(&r)[3][3]) {
+
+  try {
+    // Nutation(delta-psi, delta-eps) 計算（Bpn 毎に1回のみ）
+    if (!comp_nut()) throw;
+    // 変換行列生成
+    if (!r_fw(0.0, eps, dpsi, eps + deps, r)) throw;
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief      補間表の参照（範囲内の場合のみ）
+ *             * Bpn 毎に1回のみ参照
+ *
+ * @return     true|false（表の値を使用できない場合は false）
+ */
+bool Bpn::load_tv() {
+  if (!is_tv) {
+    is_tv  = true;
+    has_tv = (tbl != nullptr && tbl->interpolate(jcn, tv));
+  }
+
+  return has_tv;
+}
+
+/*
+ * @brief       バイアス＆歳差変換行列用 gamma, phi, psi 計算
+ *              * 補間表の範囲内であれば補間値を使用
+ *
+ * @param[ref]  gamma(double)
+ * @param[ref]  phi(double)
+ * @param[ref]  psi(double)
+ */
+void Bpn::comp_angles_bp(double& gamma, double& phi, double& psi) {
+  if (load_tv()) {
+    gamma = tv[2];
+    phi   = tv[3];
+    psi   = tv[4];
+    return;
+  }
+  gamma = comp_gamma_bp();
+  phi   = comp_phi_bp();
+  psi   = comp_psi_bp();
+}
+
 /*
  * @brief      バイアス＆歳差変換行列用 gamma 計算
  *
@@ -6,13 +6,22 @@
 #include "nutation.hpp"
 #include "obliquity.hpp"
 
+#include <atomic>
 #include <ctime>
 #include <iostream>
 #include <iomanip>   // for setprecision
 
 namespace apparent_sun_moon {
 
+class BpnCache;
+class BpnTable;
+
 class Bpn {
+  friend class BpnCache;         // キャッシュのアンカー生成で comp_r_bias_prec_nut を使用
+  friend class BpnTable;         // 補間表の生成で comp_*_bp を使用
+
+  static const BpnTable* tbl;    // 章動・歳差パラメータの補間表（未使用時は nullptr）
+  static std::atomic<unsigned long> gen_tbl;  // 補間表の設定の世代（set_table ごとに加算）
   std::vector<std::vector<double>> dat_ls;  // Parameters of lunisolar
   std::vector<std::vector<double>> dat_pl;  // Parameters of planetary
   double jcn;                    // JCN(T; ユリウス世紀数)
@@ -23,9 +32,26 @@ class Bpn {
   double r_prec[3][3];           // 回転行列（歳差）
   double r_prec_nut[3][3];       // 回転行列（歳差＆章動）
   double r_nut[3][3];            // 回転行列（章動）
+  unsigned int flg_r;            // 回転行列の生成済みフラグ（kFlg* の論理和）
+  bool   is_nut;                 // 章動計算済みフラグ
+  double dpsi;                   // 章動（Δψ; IAU 2006 補正済み）
+  double deps;                   // 章動（Δε; IAU 2006 補正済み）
+  bool   is_tv;                  // 補間表の参照済みフラグ
+  bool   has_tv;                 // 補間表の値の有無（範囲外・未使用時は false）
+  double tv[5];                  // 補間表の値（Δψ, Δε, γ, φ, ψ）
+
+  // 回転行列の種類（生成済みフラグ）
+  static constexpr unsigned int kFlgBias        = 1 << 0;
+  static constexpr unsigned int kFlgBiasPrec    = 1 << 1;
+  static constexpr unsigned int kFlgBiasPrecNut = 1 << 2;
+  static constexpr unsigned int kFlgPrec        = 1 << 3;
+  static constexpr unsigned int kFlgPrecNut     = 1 << 4;
+  static constexpr unsigned int kFlgNut         = 1 << 5;
 
 public:
   Bpn(double);                                // コンストラクタ
+  static void set_table(const BpnTable*);     // 設定: 章動・歳差パラメータの補間表
+  static unsigned long get_gen();             // 取得: 設定の世代（補間表・章動）
   bool gen_r_bias(double(&)[3][3]);           // 変換行列生成: Bias
   bool gen_r_bias_prec(double(&)[3][3]);      // 変換行列生成: バイアス＆歳差
   bool gen_r_bias_prec_nut(double(&)[3][3]);  // 変換行列生成: バイアス＆歳差＆章動
@@ -40,6 +66,17 @@ public:
   Coord apply_nut(Coord);                     // Nutation（章動） 適用
 
 private:
+  bool load_r(unsigned int);                  // 回転行列の取得（未生成の場合のみ生成）
+  bool comp_nut();                            // 計算: 章動（Δψ, Δε）
+  bool load_tv();                             // 補間表の参照（範囲内の場合のみ）
+  void comp_angles_bp(double&, double&, double&);
+                                              // 計算: バイアス＆歳差変換行列用 gamma, phi, psi
+  bool comp_r_bias(double(&)[3][3]);          // 計算: 回転行列（バイアス）
+  bool comp_r_bias_prec(double(&)[3][3]);     // 計算: 回転行列（バイアス＆歳差）
+  bool comp_r_bias_prec_nut(double(&)[3][3]); // 計算: 回転行列（バイアス＆歳差＆章動）
+  bool comp_r_prec(double(&)[3][3]);          // 計算: 回転行列（歳差）
+  bool comp_r_prec_nut(double(&)[3][3]);      // 計算: 回転行列（歳差＆章動）
+  bool comp_r_nut(double(&)[3][3]);           // 計算: 回転行列（章動）
   double comp_gamma_bp();                     // 計算: バイアス＆歳差変換行列用 gamma
   double comp_phi_bp();                       // 計算: バイアス＆歳差変換行列用 phi
   double comp_psi_bp();                       // 計算: バイアス＆歳差変換行列用 psi
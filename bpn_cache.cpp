@@ -0,0 +1,301 @@
+#include "bpn_cache.hpp"
+
+#include "bpn.hpp"
+
+#include <cmath>
+
+namespace apparent_sun_moon {
+
+// 定数
+static constexpr double kJc       = 36525.0;                  // Days per Julian century
+static constexpr double kSpanInit = 1.0 / kJc;                // アンカー間隔の初期値 (JCN; 1日)
+static constexpr double kSpanMin  = 1.0 / (86400.0 * kJc);    // アンカー間隔の下限 (JCN; 1秒)
+
+// static メンバ変数の初期化
+std::atomic<double>        BpnCache::tol{0.0};
+std::atomic<unsigned long> BpnCache::gen{0};
+thread_local BpnCacheAnc   BpnCache::anc = {kSpanInit, false, 0, {}, 0, 0, 0};
+
+/*
+ * @brief       回転行列 -> クォータニオン (w, x, y, z)
+ *
+ * @param[in]   回転行列 (double[3][3])
+ * @param[ref]  クォータニオン (double[4])
+ * @return      <none>
+ */
+static void mtx2quat(const double(&r)[3][3], double(&q)[4]) {
+  double tr = r[0][0] + r[1][1] + r[2][2];
+  double s;
+
+  if (tr > r[0][0] && tr > r[1][1] && tr > r[2][2]) {
+    s = 2.0 * std::sqrt(1.0 + tr);
+    q[0] = 0.25 * s;
+    q[1] = (r[2][1] - r[1][2]) / s;
+    q[2] = (r[0][2] - r[2][0]) / s;
+    q[3] = (r[1][0] - r[0][1]) / s;
+  } else if (r[0][0] >= r[1][1] && r[0][0] >= r[2][2]) {
+    s = 2.0 * std::sqrt(1.0 + r[0][0] - r[1][1] - r[2][2]);
+    q[0] = (r[2][1] - r[1][2]) / s;
+    q[1] = 0.25 * s;
+    q[2] = (r[0][1] + r[1][0]) / s;
+    q[3] = (r[0][2] + r[2][0]) / s;
+  } else if (r[1][1] >= r[2][2]) {
+    s = 2.0 * std::sqrt(1.0 - r[0][0] + r[1][1] - r[2][2]);
+    q[0] = (r[0][2] - r[2][0]) / s;
+    q[1] = (r[0][1] + r[1][0]) / s;
+    q[2] = 0.25 * s;
+    q[3] = (r[1][2] + r[2][1]) / s;
+  } else {
+    s = 2.0 * std::sqrt(1.0 - r[0][0] - r[1][1] + r[2][2]);
+    q[0] = (r[1][0] - r[0][1]) / s;
+    q[1] = (r[0][2] + r[2][0]) / s;
+    q[2] = (r[1][2] + r[2][1]) / s;
+    q[3] = 0.25 * s;
+  }
+}
+
+/*
+ * @brief       クォータニオン (w, x, y, z) -> 回転行列
+ *
+ * @param[in]   クォータニオン (double[4]; 正規化済み)
+ * @param[ref]  回転行列 (double[3][3])
+ * @return      <none>
+ */
+static void quat2mtx(const double(&q)[4], double(&r)[3][3]) {
+  double w = q[0];
+  double x = q[1];
+  double y = q[2];
+  double z = q[3];
+
+  r[0][0] = 1.0 - 2.0 * (y * y + z * z);
+  r[0][1] = 2.0 * (x * y - z * w);
+  r[0][2] = 2.0 * (x * z + y * w);
+  r[1][0] = 2.0 * (x * y + z * w);
+  r[1][1] = 1.0 - 2.0 * (x * x + z * z);
+  r[1][2] = 2.0 * (y * z - x * w);
+  r[2][0] = 2.0 * (x * z - y * w);
+  r[2][1] = 2.0 * (y * z + x * w);
+  r[2][2] = 1.0 - 2.0 * (x * x + y * y);
+}
+
+/*
+ * @brief       クォータニオンの補間（正規化線形補間）
+ *              * アンカー間の回転角は微小のため、球面線形補間との差は無視できる
+ *
+ * @param[in]   始点 (double[4])
+ * @param[in]   終点 (double[4]; 始点との内積が非負)
+ * @param[in]   位置 (double; 0 〜 1)
+ * @param[ref]  補間値 (double[4])
+ * @return      <none>
+ */
+static void nlerp(const double(&q_0)[4], const double(&q_1)[4], double u,
+                  double(&q)[4]) {
+  double       nrm = 0.0;
+  unsigned int i;
+
+  for (i = 0; i < 4; ++i) {
+    q[i] = q_0[i] + (q_1[i] - q_0[i]) * u;
+    nrm += q[i] * q[i];
+  }
+  nrm = 1.0 / std::sqrt(nrm);
+  for (i = 0; i < 4; ++i) { q[i] *= nrm; }
+}
+
+/*
+ * @brief       取得
+ *              * キャッシュの区間内であれば補間値、区間外であれば
+ *                リフレッシュ後に補間値を返す
+ *              * アンカーは呼び出し元スレッドのものを使用する
+ *              * 世代（キャッシュ、Bpn::get_gen）が変わっていれば、
+ *                アンカー間隔を初期値に戻し、保持中のアンカーを破棄する
+ *
+ * @param[in]   JCN (double)
+ * @param[ref]  回転行列（バイアス＆歳差＆章動） (double[3][3])
+ * @return      true|false（使用しない場合・計算できない場合は false）
+ */
+bool BpnCache::get(double jcn, double(&r)[3][3]) {
+  BpnCacheAnc&  a = anc;  // アンカー（呼び出し元スレッド）
+  double        q[4];
+  unsigned long g;        // 世代
+
+  if (!(tol.load(std::memory_order_relaxed) > 0.0)) { return false; }
+  g = gen + Bpn::get_gen();
+  if (g != a.gen) {
+    a.span   = kSpanInit;
+    a.is_anc = false;
+    a.gen    = g;
+  }
+  if (a.is_anc && static_cast<long>(std::floor(jcn / a.span)) == a.k_anc) {
+    ++a.n_hit;
+  } else if (!refresh(a, jcn)) {
+    return false;
+  }
+  nlerp(a.q_anc[0], a.q_anc[1], jcn / a.span - a.k_anc, q);
+  quat2mtx(q, r);
+
+  return true;
+}
+
+/*
+ * @brief      設定: 許容誤差
+ *             * 全スレッドのアンカー間隔を初期値に戻し、保持中のアンカーを
+ *               破棄する（各スレッドの次回の get で適用）
+ *
+ * @param[in]  許容誤差 (double; rad; 0: 使用しない)
+ * @return     <none>
+ */
+void BpnCache::set_tolerance(double tol) {
+  BpnCache::tol = (tol > 0.0) ? tol : 0.0;
+  ++gen;
+}
+
+/*
+ * @brief   取得: 許容誤差
+ *
+ * @param   <none>
+ * @return  許容誤差 (double; rad)
+ */
+double BpnCache::get_tolerance() {
+  return tol;
+}
+
+/*
+ * @brief   取得: アンカー間隔
+ *          * 呼び出し元スレッドの値
+ *
+ * @param   <none>
+ * @return  アンカー間隔 (double; 日)
+ */
+double BpnCache::get_span() {
+  return anc.span * kJc;
+}
+
+/*
+ * @brief   取得: ヒット数
+ *          * 呼び出し元スレッドの値
+ *
+ * @param   <none>
+ * @return  ヒット数 (unsigned long)
+ */
+unsigned long BpnCache::hits() {
+  return anc.n_hit;
+}
+
+/*
+ * @brief   取得: リフレッシュ数
+ *          * 呼び出し元スレッドの値
+ *
+ * @param   <none>
+ * @return  リフレッシュ数 (unsigned long)
+ */
+unsigned long BpnCache::refreshes() {
+  return anc.n_refresh;
+}
+
+/*
+ * @brief   クリア（統計含む）
+ *          * 許容誤差は保持する
+ *          * アンカーは全スレッド分を破棄する（各スレッドの次回の get で適用）
+ *          * 統計は呼び出し元スレッドの値のみクリアする
+ *
+ * @param   <none>
+ * @return  <none>
+ */
+void BpnCache::clear() {
+  ++gen;
+  anc.n_hit     = 0;
+  anc.n_refresh = 0;
+}
+
+// -------------------------------------
+// 以下、 private functions
+// -------------------------------------
+
+/*
+ * @brief      リフレッシュ（JCN を含む区間のアンカー生成）
+ *             * 隣接区間へ移動した場合は、共有する端点のアンカーを再利用
+ *             * 区間の中点で補間値と直接計算値を比較し、許容誤差を
+ *               超える場合はアンカー間隔を半分にして生成し直す
+ *             * アンカー間隔が下限に達しても許容誤差を満たせない場合は
+ *               アンカーを生成せず false を返す（呼び出し元は直接計算する）
+ *
+ * @param[ref] アンカー（呼び出し元スレッド） (BpnCacheAnc)
+ * @param[in]  JCN (double)
+ * @return     true|false
+ */
+bool BpnCache::refresh(BpnCacheAnc& a, double jcn) {
+  double       q_0[4];  // 区間の始点
+  double       q_1[4];  // 区間の終点
+  double       q_m[4];  // 区間の中点（直接計算値）
+  double       q_i[4];  // 区間の中点（補間値）
+  double       dot;
+  double       err;
+  long         k;
+  unsigned int i;
+
+  for (;;) {
+    k = static_cast<long>(std::floor(jcn / a.span));
+    if (a.is_anc && k == a.k_anc + 1) {
+      for (i = 0; i < 4; ++i) { q_0[i] = a.q_anc[1][i]; }
+      if (!comp_exact((k + 1) * a.span, q_1)) { return false; }
+    } else if (a.is_anc && k == a.k_anc - 1) {
+      if (!comp_exact(k * a.span, q_0)) { return false; }
+      for (i = 0; i < 4; ++i) { q_1[i] = a.q_anc[0][i]; }
+    } else {
+      if (!comp_exact(k * a.span, q_0)) { return false; }
+      if (!comp_exact((k + 1) * a.span, q_1)) { return false; }
+    }
+    // 同一の回転を表す符号の揃え（q と -q）
+    dot = 0.0;
+    for (i = 0; i < 4; ++i) { dot += q_0[i] * q_1[i]; }
+    if (dot < 0.0) { for (i = 0; i < 4; ++i) { q_1[i] = -q_1[i]; } }
+    // 中点での検証（回転角の差 ≒ 2 |q_i - q_m|）
+    if (!comp_exact((k + 0.5) * a.span, q_m)) { return false; }
+    nlerp(q_0, q_1, 0.5, q_i);
+    dot = 0.0;
+    for (i = 0; i < 4; ++i) { dot += q_i[i] * q_m[i]; }
+    err = 0.0;
+    for (i = 0; i < 4; ++i) {
+      err += std::pow(q_i[i] - ((dot < 0.0) ? -q_m[i] : q_m[i]), 2);
+    }
+    err = 2.0 * std::sqrt(err);
+    if (err <= tol) { break; }
+    a.is_anc = false;
+    if (a.span * 0.5 < kSpanMin) { return false; }
+    a.span *= 0.5;
+  }
+  for (i = 0; i < 4; ++i) {
+    a.q_anc[0][i] = q_0[i];
+    a.q_anc[1][i] = q_1[i];
+  }
+  a.k_anc  = k;
+  a.is_anc = true;
+  ++a.n_refresh;
+
+  return true;
+}
+
+/*
+ * @brief       計算: 直接計算値
+ *              * キャッシュを経由せず Bpn で直接計算
+ *
+ * @param[in]   JCN (double)
+ * @param[ref]  クォータニオン (double[4])
+ * @return      true|false
+ */
+bool BpnCache::comp_exact(double jcn, double(&q)[4]) {
+  double r[3][3];
+
+  try {
+    Bpn o_bpn(jcn);
+    if (!o_bpn.comp_r_bias_prec_nut(r)) { return false; }
+    mtx2quat(r, q);
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace apparent_sun_moon
+
@@ -0,0 +1,56 @@
+#ifndef APPARENT_SUN_MOON_BPN_CACHE_HPP_
+#define APPARENT_SUN_MOON_BPN_CACHE_HPP_
+
+#include <atomic>
+
+namespace apparent_sun_moon {
+
+// キャッシュのアンカー（スレッドごと）
+struct BpnCacheAnc {
+  double        span;         // アンカー間隔 (JCN)
+  bool          is_anc;       // アンカーの有無
+  long          k_anc;        // アンカー区間番号（区間: [k * span, (k + 1) * span]）
+  double        q_anc[2][4];  // アンカーのクォータニオン（区間の始点、終点）
+  unsigned long gen;          // アンカー・間隔の世代（BpnCache::gen + Bpn::get_gen）
+  unsigned long n_hit;        // ヒット数
+  unsigned long n_refresh;    // リフレッシュ数
+};
+
+// バイアス＆歳差＆章動の回転行列のキャッシュ
+// * JCN を間隔 span の区間に分け、区間両端（アンカー）の回転行列を
+//   クォータニオンで保持し、区間内は正規化線形補間で返す。
+// * 区間の生成（リフレッシュ）時に中点で直接計算値と比較し、
+//   許容誤差を超える場合は span を半分にして生成し直す。
+// * アンカー間隔が下限（1秒）でも許容誤差を満たせない場合は使用しない
+//   （get は false を返し、Bpn は直接計算する）。
+// * 許容誤差 0（既定）の場合は使用しない（Bpn は常に直接計算）。
+// * 保持中のアンカーは生成時の Nutation の設定（set_src, set_eval,
+//   set_param_file, set_truncation）、 Bpn::set_table による値のため、
+//   これらを変更した場合は次回の get で破棄して生成し直す
+//   （設定の世代 Bpn::get_gen で判定）。
+//   ただし、設定の変更は計算中の他スレッドと並行して行わないこと。
+// * アンカー・統計はスレッドごとに保持する（排他制御なし）。
+//   許容誤差はプロセス内で共有し、変更（set_tolerance, clear）は
+//   全スレッドのアンカーを次回の get で破棄する。
+class BpnCache {
+  static std::atomic<double>        tol;  // 許容誤差 (rad; 0: 使用しない)
+  static std::atomic<unsigned long> gen;  // キャッシュの世代（set_tolerance, clear ごとに加算）
+  static thread_local BpnCacheAnc   anc;  // アンカー（スレッドごと）
+
+  static bool refresh(BpnCacheAnc&, double);      // リフレッシュ（区間のアンカー生成）
+  static bool comp_exact(double, double(&)[4]);   // 計算: 直接計算値（クォータニオン）
+
+public:
+  static bool get(double, double(&)[3][3]);       // 取得（使用しない場合は false）
+  static void set_tolerance(double);              // 設定: 許容誤差 (rad)
+  static double get_tolerance();                  // 取得: 許容誤差 (rad)
+  static double get_span();                       // 取得: アンカー間隔（日; 呼び出し元スレッド）
+  static unsigned long hits();                    // 取得: ヒット数（呼び出し元スレッド）
+  static unsigned long refreshes();               // 取得: リフレッシュ数（呼び出し元スレッド）
+  static void clear();                            // クリア（統計含む）
+};
+
+}  // namespace apparent_sun_moon
+
+#endif
+
@@ -0,0 +1,345 @@
+#include "bpn_table.hpp"
+
+#include "bpn.hpp"
+#include "nutation.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace apparent_sun_moon {
+
+// 定数
+static constexpr double       kJc     = 36525.0;     // Days per Julian century
+static constexpr char         kMagic[8] = {'B', 'P', 'N', 'T', 'B', 'L', '0', '2'};
+                                                     // ファイル識別子
+static constexpr unsigned int kBefore = BpnTable::kOrder / 2 - 1;
+                                                     // 補間に使用する前方のノード数
+
+// ファイルヘッダ
+struct BpnTableHdr {
+  char          magic[8];                // ファイル識別子
+  double        jcn_0;                   // 先頭ノードの JCN
+  double        step;                    // ノード間隔 (JCN)
+  std::uint64_t n;                       // ノード数
+  double        errs[BpnTable::kItem];   // 最大誤差 (rad)
+};
+
+/*
+ * @brief  コンストラクタ（空の表）
+ *
+ * @param  <none>
+ */
+BpnTable::BpnTable()
+    : jcn_0(0.0), step(0.0), n(0), errs(), vals(nullptr),
+      base(nullptr), size(0) {}
+
+/*
+ * @brief  デストラクタ
+ *
+ * @param  <none>
+ */
+BpnTable::~BpnTable() {
+  release();
+}
+
+/*
+ * @brief      生成
+ *             * [開始, 終了] を補間できるよう、前後にノードを追加して生成
+ *             * 全区間の中点で直接計算値と比較し、最大誤差を保持
+ *             * 許容誤差を指定した場合は、最大誤差（max_err）が許容誤差以下に
+ *               なるまでノード間隔を半分にして生成し直す
+ *               （kStepMin 未満になる場合、または、間隔を半分にしても誤差が
+ *                 半分未満にならない（丸め誤差の水準）場合は表を破棄して false）
+ *             * Δψ, Δε は現在の Nutation の設定で計算する
+ *
+ * @param[in]  開始 JCN (double)
+ * @param[in]  終了 JCN (double)
+ * @param[in]  ノード間隔 (double; 日; optional)
+ * @param[in]  許容誤差 (double; rad; optional; 0: 指定しない)
+ * @return     true|false
+ */
+bool BpnTable::build(double jcn_s, double jcn_e, double step_day, double tol) {
+  double e_p;  // 直前の最大誤差
+
+  try {
+    if (!(jcn_e > jcn_s) || !(step_day > 0.0) || tol < 0.0) { return false; }
+    gen(jcn_s, jcn_e, step_day);
+    while (tol > 0.0 && max_err() > tol) {
+      e_p = max_err();
+      step_day *= 0.5;
+      if (step_day < kStepMin) {
+        release();
+        return false;
+      }
+      gen(jcn_s, jcn_e, step_day);
+      // 丸め誤差の水準に達した（間隔を半分にしても誤差が減らない）
+      if (!(max_err() < e_p * 0.5)) {
+        release();
+        return false;
+      }
+    }
+  } catch (...) {
+    release();
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief      保存
+ *             * ヘッダ（BpnTableHdr）に続けて値（[ノード][項目]）を出力
+ *
+ * @param[in]  ファイル名 (string)
+ * @return     true|false
+ */
+bool BpnTable::save(const std::string& f) const {
+  BpnTableHdr hdr;
+
+  try {
+    if (vals == nullptr) { return false; }
+    std::memcpy(hdr.magic, kMagic, sizeof(kMagic));
+    hdr.jcn_0 = jcn_0;
+    hdr.step  = step;
+    hdr.n     = static_cast<std::uint64_t>(n);
+    std::memcpy(hdr.errs, errs, sizeof(errs));
+    std::ofstream ofs(f, std::ios::binary);
+    if (!ofs) { return false; }
+    ofs.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+    ofs.write(reinterpret_cast<const char*>(vals),
+              sizeof(double) * n * kItem);
+    if (!ofs) { return false; }
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief      読み込み（メモリマップ）
+ *
+ * @param[in]  ファイル名 (string)
+ * @return     true|false
+ */
+bool BpnTable::load(const std::string& f) {
+  int         fd;
+  struct stat st;
+  void*       p;
+  BpnTableHdr hdr;
+  std::size_t n_max;  // ファイルサイズから求まるノード数の上限
+
+  release();
+  fd = open(f.c_str(), O_RDONLY);
+  if (fd < 0) {
+    std::cout << "[ERROR] " << f << " could not be opened!" << std::endl;
+    return false;
+  }
+  if (fstat(fd, &st) != 0
+      || static_cast<std::size_t>(st.st_size) < sizeof(BpnTableHdr)) {
+    std::cout << "[ERROR] " << f << " is not valid!" << std::endl;
+    close(fd);
+    return false;
+  }
+  size = static_cast<std::size_t>(st.st_size);
+  p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // マッピング後はファイルディスクリプタ不要
+  if (p == MAP_FAILED) {
+    std::cout << "[ERROR] " << f << " could not be mapped!" << std::endl;
+    size = 0;
+    return false;
+  }
+  base = static_cast<const char*>(p);
+  std::memcpy(&hdr, base, sizeof(hdr));
+  // ノード数はサイズとの積を取る前に上限と比較（オーバーフロー回避）
+  n_max = (size - sizeof(hdr)) / (sizeof(double) * kItem);
+  if (std::memcmp(hdr.magic, kMagic, sizeof(kMagic)) != 0
+      || !std::isfinite(hdr.jcn_0) || !std::isfinite(hdr.step)
+      || !(hdr.step > 0.0) || hdr.n < kOrder || hdr.n > n_max
+      || size != sizeof(hdr)
+               + sizeof(double) * static_cast<std::size_t>(hdr.n) * kItem) {
+    std::cout << "[ERROR] " << f << " is not valid!" << std::endl;
+    release();
+    return false;
+  }
+  jcn_0 = hdr.jcn_0;
+  step  = hdr.step;
+  n     = static_cast<std::size_t>(hdr.n);
+  std::memcpy(errs, hdr.errs, sizeof(errs));
+  vals  = reinterpret_cast<const double*>(base + sizeof(hdr));
+
+  return true;
+}
+
+/*
+ * @brief       補間
+ *
+ * @param[in]   JCN (double)
+ * @param[ref]  値 (double[kItem]; Δψ, Δε, γ, φ, ψ (rad))
+ * @return      true|false（範囲外の場合は false）
+ */
+bool BpnTable::interpolate(double jcn, double(&v)[kItem]) const {
+  double      u;
+  std::size_t i;
+
+  if (vals == nullptr) { return false; }
+  u = (jcn - jcn_0) / step;
+  if (!(u >= kBefore)) { return false; }
+  i = static_cast<std::size_t>(u);
+  if (i + kOrder - kBefore - 1 >= n) { return false; }
+  calc_interp(i, u - i, v);
+
+  return true;
+}
+
+/*
+ * @brief   最大誤差
+ *          * 生成時に全区間の中点で検証した値（全項目の最大）
+ *
+ * @param   <none>
+ * @return  最大誤差 (double; rad)
+ */
+double BpnTable::max_err() const {
+  double       e = 0.0;
+  unsigned int k;
+
+  for (k = 0; k < kItem; ++k) { e = std::fmax(e, errs[k]); }
+
+  return e;
+}
+
+/*
+ * @brief   ノード間隔
+ *          * 許容誤差を指定して生成した場合は、調整後の間隔
+ *
+ * @param   <none>
+ * @return  ノード間隔 (double; 日)
+ */
+double BpnTable::get_step() const {
+  return step * kJc;
+}
+
+// -------------------------------------
+// 以下、 private functions
+// -------------------------------------
+
+/*
+ * @brief   解放
+ *
+ * @param   <none>
+ * @return  <none>
+ */
+void BpnTable::release() {
+  unsigned int k;
+
+  if (base != nullptr) { munmap(const_cast<char*>(base), size); }
+  base = nullptr;
+  size = 0;
+  buf.clear();
+  vals = nullptr;
+  n    = 0;
+  step = 0.0;
+  for (k = 0; k < kItem; ++k) { errs[k] = 0.0; }
+}
+
+/*
+ * @brief      生成（ノード間隔固定）
+ *             * [開始, 終了] を補間できるよう、前後にノードを追加して生成
+ *             * 全区間の中点で直接計算値と比較し、最大誤差を保持
+ *
+ * @param[in]  開始 JCN (double)
+ * @param[in]  終了 JCN (double)
+ * @param[in]  ノード間隔 (double; 日)
+ * @return     <none>
+ */
+void BpnTable::gen(double jcn_s, double jcn_e, double step_day) {
+  double       v_e[kItem];  // 直接計算値
+  double       v_i[kItem];  // 補間値
+  std::size_t  i;
+  unsigned int k;
+
+  try {
+    release();
+    step  = step_day / kJc;
+    jcn_0 = jcn_s - kBefore * step;
+    n     = static_cast<std::size_t>(std::ceil((jcn_e - jcn_s) / step))
+          + kOrder;
+    buf.resize(n * kItem);
+    for (i = 0; i < n; ++i) {
+      calc_exact(jcn_0 + i * step, v_e);
+      for (k = 0; k < kItem; ++k) { buf[i * kItem + k] = v_e[k]; }
+    }
+    vals = buf.data();
+
+    // 検証（補間に使用する全区間の中点）
+    for (k = 0; k < kItem; ++k) { errs[k] = 0.0; }
+    for (i = kBefore; i + kOrder - kBefore - 1 < n; ++i) {
+      calc_exact(jcn_0 + (i + 0.5) * step, v_e);
+      calc_interp(i, 0.5, v_i);
+      for (k = 0; k < kItem; ++k) {
+        errs[k] = std::fmax(errs[k], std::fabs(v_i[k] - v_e[k]));
+      }
+    }
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief       計算: 直接計算値
+ *
+ * @param[in]   JCN (double)
+ * @param[ref]  値 (double[kItem]; Δψ, Δε, γ, φ, ψ (rad))
+ * @return      <none>
+ */
+void BpnTable::calc_exact(double jcn, double(&v)[kItem]) {
+  Nutation o_n(jcn);
+  if (!o_n.calc_nutation(v[0], v[1])) {
+    throw "[ERROR] Could not calculate delta-psi, delta-epsilon!";
+  }
+  Bpn o_bpn(jcn);
+  v[2] = o_bpn.comp_gamma_bp();
+  v[3] = o_bpn.comp_phi_bp();
+  v[4] = o_bpn.comp_psi_bp();
+}
+
+/*
+ * @brief       計算: 補間値（kOrder 点の Lagrange 補間）
+ *              * ノード i - kBefore 〜 i + kOrder - kBefore - 1 を使用
+ *
+ * @param[in]   区間のノードインデックス (size_t)
+ * @param[in]   区間内の位置 (double; 0 〜 1)
+ * @param[ref]  値 (double[kItem])
+ * @return      <none>
+ */
+void BpnTable::calc_interp(
+    std::size_t i, double p, double(&v)[kItem]) const {
+  double       w[kOrder];  // 重み
+  const double* r;
+  int          j;
+  int          m;
+  unsigned int k;
+
+  for (j = 0; j < static_cast<int>(kOrder); ++j) {
+    w[j] = 1.0;
+    for (m = 0; m < static_cast<int>(kOrder); ++m) {
+      if (m == j) { continue; }
+      w[j] *= (p - (m - static_cast<int>(kBefore)))
+            / static_cast<double>(j - m);
+    }
+  }
+  for (k = 0; k < kItem; ++k) { v[k] = 0.0; }
+  for (j = 0; j < static_cast<int>(kOrder); ++j) {
+    r = vals + (i - kBefore + j) * kItem;
+    for (k = 0; k < kItem; ++k) { v[k] += w[j] * r[k]; }
+  }
+}
+
+}  // namespace apparent_sun_moon
+
@@ -0,0 +1,63 @@
+#ifndef APPARENT_SUN_MOON_BPN_TABLE_HPP_
+#define APPARENT_SUN_MOON_BPN_TABLE_HPP_
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace apparent_sun_moon {
+
+// 章動・歳差パラメータの補間表
+// * 等間隔（既定 0.5 日）のノードに Δψ, Δε（IAU 2000A; 補正前）と
+//   バイアス＆歳差の角度 γ, φ, ψ（Fukushima-Williams）を保持し、
+//   kOrder 点の Lagrange 補間で値を返す。
+// * 生成時に全区間の中点で直接計算値と比較し、最大誤差を保持する。
+//   許容誤差を指定した場合は、最大誤差が許容誤差以下になるまで
+//   ノード間隔を半分にして生成し直す（下限 kStepMin で満たせなければ失敗）。
+// * ファイルに保存し、メモリマップで読み込むことができる。
+// * 生成・読み込み後は変更しない（Bpn::set_table で共有して使用する）。
+// * Δψ, Δε は生成時の Nutation の設定（set_src, set_eval, set_truncation,
+//   set_param_file）で計算した値。生成後に設定を変更しても表には反映されない
+//   （変更後の設定で使用する場合は生成し直すこと）。
+class BpnTable {
+public:
+  static constexpr unsigned int kItem  = 5;  // 項目数（Δψ, Δε, γ, φ, ψ）
+  static constexpr unsigned int kOrder = 8;  // 補間点数
+  static constexpr double kStepMin = 1.0 / 1440.0;
+                                             // ノード間隔の下限（日; 許容誤差指定時）
+
+private:
+  double              jcn_0;         // 先頭ノードの JCN
+  double              step;          // ノード間隔 (JCN)
+  std::size_t         n;             // ノード数
+  double              errs[kItem];   // 最大誤差（中点での検証値; rad）
+  std::vector<double> buf;           // 値（生成時; [ノード][項目]）
+  const double*       vals;          // 値の先頭（buf またはマッピング）
+  const char*         base;          // マッピング先頭アドレス（読み込み時）
+  std::size_t         size;          // マッピングサイズ
+
+  BpnTable(const BpnTable&) = delete;
+  BpnTable& operator=(const BpnTable&) = delete;
+  void   release();                                      // 解放
+  void   gen(double, double, double);                    // 生成（ノード間隔固定）
+  static void calc_exact(double, double(&)[kItem]);      // 計算: 直接計算値
+  void   calc_interp(std::size_t, double, double(&)[kItem]) const;
+                                                         // 計算: 補間値
+
+public:
+  BpnTable();                                            // コンストラクタ
+  ~BpnTable();                                           // デストラクタ
+  bool   build(double, double, double = 0.5, double = 0.0);
+                                                         // 生成（許容誤差指定可）
+  bool   save(const std::string&) const;                 // 保存
+  bool   load(const std::string&);                       // 読み込み（メモリマップ）
+  bool   interpolate(double, double(&)[kItem]) const;    // 補間
+  double max_err() const;                                // 最大誤差 (rad)
+  double get_step() const;                               // ノード間隔（日）
+};
+
+}  // namespace apparent_sun_moon
+
+#endif
+
@@ -0,0 +1,80 @@
+#include "calendar.hpp"
+
+namespace apparent_sun_moon {
+
+// 定数
+static constexpr long   kSecDay  = 86400;          // 1日の秒数
+static constexpr double kJdEpoch = 2440587.5;      // 1970-01-01 00:00:00 の JD
+static constexpr double kNsDay   = 86400.0e9;      // 1日のナノ秒数
+
+/*
+ * @brief      timespec -> 日数（1970-01-01 からの通日）
+ *
+ * @param[in]  日時 (timespec)
+ * @return     日数 (long)
+ */
+long days_from_ts(struct timespec ts) {
+  long days = ts.tv_sec / kSecDay;
+
+  if (ts.tv_sec % kSecDay < 0) { --days; }  // 負の場合は切り捨て
+
+  return days;
+}
+
+/*
+ * @brief      timespec -> 日時
+ *
+ * @param[in]  日時 (timespec)
+ * @return     日時 (DateTime)
+ */
+DateTime ts2dt(struct timespec ts) {
+  DateTime dt;
+  long     days = days_from_ts(ts);
+  long     secs = ts.tv_sec - days * kSecDay;  // 日内の秒数
+
+  civil_from_days(days, dt.year, dt.month, dt.day);
+  dt.hour = static_cast<unsigned int>(secs / 3600);
+  dt.min  = static_cast<unsigned int>(secs % 3600 / 60);
+  dt.sec  = static_cast<unsigned int>(secs % 60);
+  dt.nsec = ts.tv_nsec;
+
+  return dt;
+}
+
+/*
+ * @brief      日時 -> timespec
+ *             * 日が範囲外の場合は前後の月へ繰り越す（0 日は前月末日）
+ *
+ * @param[in]  日時 (DateTime)
+ * @return     日時 (timespec)
+ */
+struct timespec dt2ts(const DateTime& dt) {
+  struct timespec ts;
+
+  ts.tv_sec  = (days_from_civil(dt.year, dt.month, 1)
+                + static_cast<long>(dt.day) - 1) * kSecDay
+             + dt.hour * 3600L + dt.min * 60L + dt.sec;
+  ts.tv_nsec = dt.nsec;
+
+  return ts;
+}
+
+/*
+ * @brief       timespec -> JD（2分割）
+ *              * 日数部は 0h の JD（x.5）で正確に表現され、
+ *                日の端数のみが丸め誤差を持つ
+ *
+ * @param[in]   日時 (timespec)
+ * @param[ref]  JD の日数部 (double)
+ * @param[ref]  JD の日の端数 (double; 0 <= f < 1)
+ * @return      <none>
+ */
+void ts2jd(struct timespec ts, double& jd_1, double& jd_2) {
+  long days = days_from_ts(ts);
+
+  jd_1 = kJdEpoch + days;
+  jd_2 = ((ts.tv_sec - days * kSecDay) * 1.0e9 + ts.tv_nsec) / kNsDay;
+}
+
+}  // namespace apparent_sun_moon
+
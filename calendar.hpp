@@ -0,0 +1,86 @@
+#ifndef APPARENT_SUN_MOON_CALENDAR_HPP_
+#define APPARENT_SUN_MOON_CALENDAR_HPP_
+
+#include <ctime>
+
+namespace apparent_sun_moon {
+
+// 暦計算（タイムゾーン非依存）
+// * timespec の tv_sec は、1970-01-01 00:00:00 からの経過秒数として
+//   その時刻系の暦日時へ直接変換する（うるう秒は含まない）
+// * libc の時刻関数（localtime_r, mktime 等）を使用しないため、
+//   TZ に依存せず、複数スレッドから同時に呼び出し可能
+// * 日数の計算は先発グレゴリオ暦（H. Hinnant, "chrono-Compatible
+//   Low-Level Date Algorithms" の days_from_civil / civil_from_days）
+
+// 日時
+struct DateTime {
+  int          year;   // 年
+  unsigned int month;  // 月 (1 - 12)
+  unsigned int day;    // 日 (1 - 31)
+  unsigned int hour;   // 時 (0 - 23)
+  unsigned int min;    // 分 (0 - 59)
+  unsigned int sec;    // 秒 (0 - 59)
+  long         nsec;   // ナノ秒
+};
+
+/*
+ * @brief      年月日 -> 日数（1970-01-01 からの通日）
+ *
+ * @param[in]  年 (int)
+ * @param[in]  月 (unsigned int)
+ * @param[in]  日 (unsigned int)
+ * @return     日数 (long)
+ */
+constexpr long days_from_civil(int y, unsigned int m, unsigned int d) {
+  long         era = 0;  // 400 年周期
+  unsigned int yoe = 0;  // 周期内の年   (0 - 399)
+  unsigned int doy = 0;  // 年内の日     (0 - 365; 3月1日起算)
+  unsigned int doe = 0;  // 周期内の日   (0 - 146096)
+
+  y  -= (m <= 2);
+  era = (y >= 0 ? y : y - 399) / 400;
+  yoe = static_cast<unsigned int>(y - era * 400);
+  doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+  return era * 146097 + static_cast<long>(doe) - 719468;
+}
+
+/*
+ * @brief       日数（1970-01-01 からの通日） -> 年月日
+ *
+ * @param[in]   日数 (long)
+ * @param[ref]  年 (int)
+ * @param[ref]  月 (unsigned int)
+ * @param[ref]  日 (unsigned int)
+ * @return      <none>
+ */
+constexpr void civil_from_days(
+    long z, int& y, unsigned int& m, unsigned int& d) {
+  long         era = 0;  // 400 年周期
+  unsigned int doe = 0;  // 周期内の日   (0 - 146096)
+  unsigned int yoe = 0;  // 周期内の年   (0 - 399)
+  unsigned int doy = 0;  // 年内の日     (0 - 365; 3月1日起算)
+  unsigned int mp  = 0;  // 月           (0 - 11; 3月起算)
+
+  z  += 719468;
+  era = (z >= 0 ? z : z - 146096) / 146097;
+  doe = static_cast<unsigned int>(z - era * 146097);
+  yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  mp  = (5 * doy + 2) / 153;
+  d   = doy - (153 * mp + 2) / 5 + 1;
+  m   = mp < 10 ? mp + 3 : mp - 9;
+  y   = static_cast<int>(yoe + era * 400 + (m <= 2));
+}
+
+long days_from_ts(struct timespec);                // timespec -> 日数
+DateTime ts2dt(struct timespec);                   // timespec -> 日時
+struct timespec dt2ts(const DateTime&);            // 日時 -> timespec
+void ts2jd(struct timespec, double&, double&);     // timespec -> JD（2分割）
+
+}  // namespace apparent_sun_moon
+
+#endif
+
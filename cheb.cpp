@@ -0,0 +1,568 @@
+#include "cheb.hpp"
+
+#include <array>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define APPARENT_SUN_MOON_CHEB_X86
+#include <immintrin.h>
+#endif
+
+namespace apparent_sun_moon {
+
+// 評価関数の型（複数時刻）
+using ChebMultiFunc = void (*)(const double*, unsigned int, unsigned int,
+                               const double*, unsigned int, unsigned int,
+                               double* const*, double* const*);
+
+/*
+ * @brief       チェビシェフ多項式とその微分の値（T_j(tc), T'_j(tc)）
+ *              * 位置用・速度用の漸化式を1つのループで計算
+ *
+ * @param[in]   係数の数 (unsigned int)
+ * @param[in]   チェビシェフ時間 (double)
+ * @param[ref]  T_j  (double[kChebMax])
+ * @param[ref]  T'_j (double[kChebMax])
+ *              * 常にインライン展開（係数の数が定数の場合はループが展開される）
+ */
+__attribute__((always_inline))
+static inline void cheb_basis(
+    unsigned int n, double tc, double(&t)[kChebMax], double(&d)[kChebMax]) {
+  unsigned int j;
+  double       tc2 = 2.0 * tc;
+
+  t[0] = 1.0;
+  t[1] = tc;
+  d[0] = 0.0;
+  d[1] = 1.0;
+  for (j = 2; j < n; ++j) {
+    t[j] = tc2 * t[j - 1] - t[j - 2];
+    d[j] = tc2 * d[j - 1] + 2.0 * t[j - 1] - d[j - 2];
+  }
+}
+
+/*
+ * @brief       1時刻の評価（スカラー）
+ *
+ * @param[in]   係数 (const double*; [要素数][係数の数])
+ * @param[in]   係数の数 (unsigned int)
+ * @param[in]   要素数 (unsigned int)
+ * @param[in]   チェビシェフ時間 (double)
+ * @param[ref]  位置 (double[3])
+ * @param[ref]  速度 (double[3])
+ */
+__attribute__((always_inline))
+static inline void cheb_eval_scalar(
+    const double* c, unsigned int n, unsigned int n_item,
+    double tc, double(&pos)[3], double(&vel)[3]) {
+  double       t[kChebMax];  // T_j(tc)
+  double       d[kChebMax];  // T'_j(tc)
+  unsigned int i;
+  unsigned int j;
+  double       p;
+  double       v;
+
+  cheb_basis(n, tc, t, d);
+  for (i = 0; i < n_item; ++i) {
+    p = 0.0;
+    v = 0.0;
+    for (j = 0; j < n; ++j) {
+      p += c[i * n + j] * t[j];
+      v += c[i * n + j] * d[j];
+    }
+    pos[i] = p;
+    vel[i] = v;
+  }
+}
+
+/*
+ * @brief       複数時刻の評価（スカラー）
+ *              * 時刻 [e_0, m) を1時刻ずつ評価
+ *              * 積和は j の昇順（SIMD 版のレーンと同じ順序）
+ *
+ * @param[in]   係数 (const double*)
+ * @param[in]   係数の数 (unsigned int)
+ * @param[in]   要素数 (unsigned int)
+ * @param[in]   チェビシェフ時間 (const double*)
+ * @param[in]   開始インデックス (unsigned int)
+ * @param[in]   時刻数 (unsigned int)
+ * @param[out]  位置 (double* const*; [要素数][時刻数])
+ * @param[out]  速度 (double* const*; [要素数][時刻数])
+ */
+static void cheb_multi_scalar(
+    const double* c, unsigned int n, unsigned int n_item,
+    const double* tcs, unsigned int e_0, unsigned int m,
+    double* const* pos, double* const* vel) {
+  unsigned int e;
+  unsigned int i;
+  unsigned int j;
+  double       t[kChebMax];
+  double       d[kChebMax];
+  double       p;
+  double       v;
+
+  for (e = e_0; e < m; ++e) {
+    cheb_basis(n, tcs[e], t, d);
+    for (i = 0; i < n_item; ++i) {
+      p = 0.0;
+      v = 0.0;
+      for (j = 0; j < n; ++j) {
+        p += c[i * n + j] * t[j];
+        v += c[i * n + j] * d[j];
+      }
+      pos[i][e] = p;
+      vel[i][e] = v;
+    }
+  }
+}
+
+#ifdef APPARENT_SUN_MOON_CHEB_X86
+/*
+ * @brief       1時刻の評価（SSE2; 位置・速度の2レーン）
+ *              * レーンを (位置, 速度) とし、基底 (T_j, T'_j) の漸化式と
+ *                係数との積和を同時に計算（水平加算なし）
+ *              * T'_j = 2 tc T'_{j-1} + 2 T_{j-1} - T'_{j-2} の 2 T_{j-1} は
+ *                速度レーンのみに加算（位置レーンは 0 を加算）
+ *              * 各レーンの演算順序はスカラー版と同じ（結果は一致する）
+ *
+ * @param[in]   係数 (const double*; [要素数][係数の数])
+ * @param[in]   係数の数 (unsigned int)
+ * @param[in]   要素数 (unsigned int)
+ * @param[in]   チェビシェフ時間 (double)
+ * @param[ref]  位置 (double[3])
+ * @param[ref]  速度 (double[3])
+ */
+__attribute__((target("sse2"), always_inline))
+static inline void cheb_eval_sse2(
+    const double* c, unsigned int n, unsigned int n_item,
+    double tc, double(&pos)[3], double(&vel)[3]) {
+  unsigned int  i;
+  unsigned int  j;
+  __m128d       acc[3];
+  __m128d       b_0 = _mm_setr_pd(1.0, 0.0);  // (T_0, T'_0)
+  __m128d       b_1 = _mm_setr_pd(tc, 1.0);   // (T_1, T'_1)
+  __m128d       b_2;
+  const __m128d tc2  = _mm_set1_pd(2.0 * tc);
+  const __m128d two  = _mm_set1_pd(2.0);
+  const __m128d zero = _mm_setzero_pd();
+  double        wk[2];
+
+  for (i = 0; i < n_item; ++i) {
+    acc[i] = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(c[i * n]), b_0),
+                        _mm_mul_pd(_mm_set1_pd(c[i * n + 1]), b_1));
+  }
+  for (j = 2; j < n; ++j) {
+    b_2 = _mm_sub_pd(
+        _mm_add_pd(_mm_mul_pd(tc2, b_1),
+                   _mm_unpacklo_pd(zero, _mm_mul_pd(two, b_1))),
+        b_0);
+    for (i = 0; i < n_item; ++i) {
+      acc[i] = _mm_add_pd(acc[i], _mm_mul_pd(_mm_set1_pd(c[i * n + j]), b_2));
+    }
+    b_0 = b_1;
+    b_1 = b_2;
+  }
+  for (i = 0; i < n_item; ++i) {
+    _mm_storeu_pd(wk, acc[i]);
+    pos[i] = wk[0];
+    vel[i] = wk[1];
+  }
+}
+
+/*
+ * @brief       1時刻の評価（AVX2; 要素 0, 1 の位置・速度の4レーン）
+ *              * レーンを (位置_0, 速度_0, 位置_1, 速度_1) とし、
+ *                要素 2 は下位 128 bit（SSE2 版と同じ）で計算
+ *              * 基底・積和の考え方、演算順序は SSE2 版と同じ
+ *
+ * @param[in]   係数 (const double*; [要素数][係数の数])
+ * @param[in]   係数の数 (unsigned int)
+ * @param[in]   要素数 (unsigned int)
+ * @param[in]   チェビシェフ時間 (double)
+ * @param[ref]  位置 (double[3])
+ * @param[ref]  速度 (double[3])
+ */
+__attribute__((target("avx2"), always_inline))
+static inline void cheb_eval_avx2(
+    const double* c, unsigned int n, unsigned int n_item,
+    double tc, double(&pos)[3], double(&vel)[3]) {
+  unsigned int  j;
+  __m256d       acc_01;                               // 要素 0, 1
+  __m128d       acc_2;                                // 要素 2
+  __m256d       b_0 = _mm256_setr_pd(1.0, 0.0, 1.0, 0.0);
+  __m256d       b_1 = _mm256_setr_pd(tc, 1.0, tc, 1.0);
+  __m256d       b_2;
+  const __m256d tc2  = _mm256_set1_pd(2.0 * tc);
+  const __m256d two  = _mm256_set1_pd(2.0);
+  const __m256d zero = _mm256_setzero_pd();
+  const double* c_1  = (n_item > 1) ? c + n : c;      // 要素 1（なければ 0 を再計算）
+  double        wk[4];
+
+  acc_01 = _mm256_add_pd(
+      _mm256_mul_pd(_mm256_setr_pd(c[0], c[0], c_1[0], c_1[0]), b_0),
+      _mm256_mul_pd(_mm256_setr_pd(c[1], c[1], c_1[1], c_1[1]), b_1));
+  acc_2  = _mm_setzero_pd();
+  if (n_item > 2) {
+    acc_2 = _mm_add_pd(
+        _mm_mul_pd(_mm_set1_pd(c[2 * n]), _mm256_castpd256_pd128(b_0)),
+        _mm_mul_pd(_mm_set1_pd(c[2 * n + 1]), _mm256_castpd256_pd128(b_1)));
+  }
+  for (j = 2; j < n; ++j) {
+    b_2 = _mm256_sub_pd(
+        _mm256_add_pd(_mm256_mul_pd(tc2, b_1),
+                      _mm256_unpacklo_pd(zero, _mm256_mul_pd(two, b_1))),
+        b_0);
+    acc_01 = _mm256_add_pd(
+        acc_01,
+        _mm256_mul_pd(_mm256_setr_pd(c[j], c[j], c_1[j], c_1[j]), b_2));
+    if (n_item > 2) {
+      acc_2 = _mm_add_pd(acc_2, _mm_mul_pd(_mm_set1_pd(c[2 * n + j]),
+                                           _mm256_castpd256_pd128(b_2)));
+    }
+    b_0 = b_1;
+    b_1 = b_2;
+  }
+  _mm256_storeu_pd(wk, acc_01);
+  if (n_item > 0) {
+    pos[0] = wk[0];
+    vel[0] = wk[1];
+  }
+  if (n_item > 1) {
+    pos[1] = wk[2];
+    vel[1] = wk[3];
+  }
+  if (n_item > 2) {
+    _mm_storeu_pd(wk, acc_2);
+    pos[2] = wk[0];
+    vel[2] = wk[1];
+  }
+}
+
+/*
+ * @brief       複数時刻の評価（SSE2; 2時刻並列）
+ *              * T_j, T'_j の漸化式をレーン単位で計算し、
+ *                係数はブロードキャストして全レーンで共有
+ *
+ * @param[in]   係数 (const double*)
+ * @param[in]   係数の数 (unsigned int)
+ * @param[in]   要素数 (unsigned int)
+ * @param[in]   チェビシェフ時間 (const double*)
+ * @param[in]   開始インデックス (unsigned int)
+ * @param[in]   時刻数 (unsigned int)
+ * @param[out]  位置 (double* const*; [要素数][時刻数])
+ * @param[out]  速度 (double* const*; [要素数][時刻数])
+ */
+__attribute__((target("sse2")))
+static void cheb_multi_sse2(
+    const double* c, unsigned int n, unsigned int n_item,
+    const double* tcs, unsigned int e_0, unsigned int m,
+    double* const* pos, double* const* vel) {
+  unsigned int e;
+  unsigned int i;
+  unsigned int j;
+  __m128d      acc_p[3];
+  __m128d      acc_v[3];
+  __m128d      t_0, t_1, t_2;
+  __m128d      d_0, d_1, d_2;
+  __m128d      tc2;
+  __m128d      vc;
+  const __m128d two = _mm_set1_pd(2.0);
+
+  for (e = e_0; e + 2 <= m; e += 2) {
+    t_0 = _mm_set1_pd(1.0);
+    t_1 = _mm_loadu_pd(tcs + e);
+    d_0 = _mm_setzero_pd();
+    d_1 = _mm_set1_pd(1.0);
+    tc2 = _mm_mul_pd(two, t_1);
+    for (i = 0; i < n_item; ++i) {
+      acc_p[i] = _mm_add_pd(_mm_set1_pd(c[i * n]),
+                            _mm_mul_pd(_mm_set1_pd(c[i * n + 1]), t_1));
+      acc_v[i] = _mm_set1_pd(c[i * n + 1]);
+    }
+    for (j = 2; j < n; ++j) {
+      t_2 = _mm_sub_pd(_mm_mul_pd(tc2, t_1), t_0);
+      d_2 = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(tc2, d_1), _mm_mul_pd(two, t_1)),
+                       d_0);
+      for (i = 0; i < n_item; ++i) {
+        vc = _mm_set1_pd(c[i * n + j]);
+        acc_p[i] = _mm_add_pd(acc_p[i], _mm_mul_pd(vc, t_2));
+        acc_v[i] = _mm_add_pd(acc_v[i], _mm_mul_pd(vc, d_2));
+      }
+      t_0 = t_1;
+      t_1 = t_2;
+      d_0 = d_1;
+      d_1 = d_2;
+    }
+    for (i = 0; i < n_item; ++i) {
+      _mm_storeu_pd(pos[i] + e, acc_p[i]);
+      _mm_storeu_pd(vel[i] + e, acc_v[i]);
+    }
+  }
+  cheb_multi_scalar(c, n, n_item, tcs, e, m, pos, vel);
+}
+
+/*
+ * @brief       複数時刻の評価（AVX2; 4時刻並列）
+ *              * T_j, T'_j の漸化式をレーン単位で計算し、
+ *                係数はブロードキャストして全レーンで共有
+ *
+ * @param[in]   係数 (const double*)
+ * @param[in]   係数の数 (unsigned int)
+ * @param[in]   要素数 (unsigned int)
+ * @param[in]   チェビシェフ時間 (const double*)
+ * @param[in]   開始インデックス (unsigned int)
+ * @param[in]   時刻数 (unsigned int)
+ * @param[out]  位置 (double* const*; [要素数][時刻数])
+ * @param[out]  速度 (double* const*; [要素数][時刻数])
+ */
+__attribute__((target("avx2")))
+static void cheb_multi_avx2(
+    const double* c, unsigned int n, unsigned int n_item,
+    const double* tcs, unsigned int e_0, unsigned int m,
+    double* const* pos, double* const* vel) {
+  unsigned int e;
+  unsigned int i;
+  unsigned int j;
+  __m256d      acc_p[3];
+  __m256d      acc_v[3];
+  __m256d      t_0, t_1, t_2;
+  __m256d      d_0, d_1, d_2;
+  __m256d      tc2;
+  __m256d      vc;
+  const __m256d two = _mm256_set1_pd(2.0);
+
+  for (e = e_0; e + 4 <= m; e += 4) {
+    t_0 = _mm256_set1_pd(1.0);
+    t_1 = _mm256_loadu_pd(tcs + e);
+    d_0 = _mm256_setzero_pd();
+    d_1 = _mm256_set1_pd(1.0);
+    tc2 = _mm256_mul_pd(two, t_1);
+    for (i = 0; i < n_item; ++i) {
+      acc_p[i] = _mm256_add_pd(
+          _mm256_set1_pd(c[i * n]),
+          _mm256_mul_pd(_mm256_set1_pd(c[i * n + 1]), t_1));
+      acc_v[i] = _mm256_set1_pd(c[i * n + 1]);
+    }
+    for (j = 2; j < n; ++j) {
+      t_2 = _mm256_sub_pd(_mm256_mul_pd(tc2, t_1), t_0);
+      d_2 = _mm256_sub_pd(
+          _mm256_add_pd(_mm256_mul_pd(tc2, d_1), _mm256_mul_pd(two, t_1)),
+          d_0);
+      for (i = 0; i < n_item; ++i) {
+        vc = _mm256_set1_pd(c[i * n + j]);
+        acc_p[i] = _mm256_add_pd(acc_p[i], _mm256_mul_pd(vc, t_2));
+        acc_v[i] = _mm256_add_pd(acc_v[i], _mm256_mul_pd(vc, d_2));
+      }
+      t_0 = t_1;
+      t_1 = t_2;
+      d_0 = d_1;
+      d_1 = d_2;
+    }
+    for (i = 0; i < n_item; ++i) {
+      _mm256_storeu_pd(pos[i] + e, acc_p[i]);
+      _mm256_storeu_pd(vel[i] + e, acc_v[i]);
+    }
+  }
+  cheb_multi_sse2(c, n, n_item, tcs, e, m, pos, vel);
+}
+#endif
+
+// 実装（命令セット）
+enum ChebIsa : unsigned int { kIsaScalar = 0, kIsaSse2 = 1, kIsaAvx2 = 2 };
+
+/*
+ * @brief   実装の選択（CPU 判定; 初回使用時に判定）
+ *
+ * @param   <none>
+ * @return  実装 (ChebIsa)
+ */
+static ChebIsa get_isa() {
+  static const ChebIsa isa = []() {
+#ifdef APPARENT_SUN_MOON_CHEB_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) { return kIsaAvx2; }
+    if (__builtin_cpu_supports("sse2")) { return kIsaSse2; }
+#endif
+    return kIsaScalar;
+  }();
+
+  return isa;
+}
+
+/*
+ * @brief   使用する実装（1時刻; 係数の数は実行時）
+ *
+ * @param   <none>
+ * @return  評価関数 (ChebEval)
+ */
+static ChebEval get_func() {
+#ifdef APPARENT_SUN_MOON_CHEB_X86
+  if (get_isa() == kIsaAvx2) { return cheb_eval_avx2; }
+  if (get_isa() == kIsaSse2) { return cheb_eval_sse2; }
+#endif
+  return cheb_eval_scalar;
+}
+
+/*
+ * @brief   使用する実装（複数時刻）
+ *
+ * @param   <none>
+ * @return  評価関数 (ChebMultiFunc)
+ */
+static ChebMultiFunc get_multi_func() {
+#ifdef APPARENT_SUN_MOON_CHEB_X86
+  if (get_isa() == kIsaAvx2) { return cheb_multi_avx2; }
+  if (get_isa() == kIsaSse2) { return cheb_multi_sse2; }
+#endif
+  return cheb_multi_scalar;
+}
+
+/*
+ * @brief       チェビシェフ多項式の評価（位置・速度(微分)を同時に計算）
+ *              * 速度は tc についての微分値
+ *                （サブ区間長等による換算は呼び出し元で行う）
+ *              * 作業領域はスタック上に確保（ヒープ確保なし）
+ *
+ * @param[in]   係数 (const double*; [要素数][係数の数])
+ * @param[in]   係数の数 (unsigned int; 2 〜 kChebMax)
+ * @param[in]   要素数 (unsigned int; 3 以下)
+ * @param[in]   チェビシェフ時間 (double)
+ * @param[ref]  位置 (double[3])
+ * @param[ref]  速度 (double[3])
+ */
+void cheb_eval(const double* c, unsigned int n, unsigned int n_item,
+               double tc, double(&pos)[3], double(&vel)[3]) {
+  static const ChebEval func = get_func();
+
+  if (n < 2 || n > kChebMax || n_item > 3) {
+    throw "[ERROR] Invalid count of Chebyshev coefficients!";
+  }
+  func(c, n, n_item, tc, pos, vel);
+}
+
+/*
+ * @brief       チェビシェフ多項式の評価（同一係数・複数時刻）
+ *              * 同一レコード・同一サブ区間の時刻をまとめて評価し、
+ *                係数の読み込みを時刻間で共有する
+ *              * 速度は tc についての微分値
+ *                （サブ区間長等による換算は呼び出し元で行う）
+ *
+ * @param[in]   係数 (const double*; [要素数][係数の数])
+ * @param[in]   係数の数 (unsigned int; 2 〜 kChebMax)
+ * @param[in]   要素数 (unsigned int; 3 以下)
+ * @param[in]   チェビシェフ時間 (const double*; [時刻数])
+ * @param[in]   時刻数 (unsigned int)
+ * @param[out]  位置 (double* const*; [要素数][時刻数])
+ * @param[out]  速度 (double* const*; [要素数][時刻数])
+ */
+void cheb_eval_multi(const double* c, unsigned int n, unsigned int n_item,
+                     const double* tcs, unsigned int m,
+                     double* const* pos, double* const* vel) {
+  static const ChebMultiFunc func = get_multi_func();
+
+  if (n < 2 || n > kChebMax || n_item > 3) {
+    throw "[ERROR] Invalid count of Chebyshev coefficients!";
+  }
+  func(c, n, n_item, tcs, 0, m, pos, vel);
+}
+
+/*
+ * @brief       チェビシェフ多項式の評価（係数の数 N で特殊化）
+ *              * 1時刻の評価（cheb_eval_*）をインライン展開し、
+ *                N がコンパイル時定数のためループが展開される
+ *              * 実装（スカラー / SSE2 / AVX2）は cheb_eval と同じで、
+ *                結果は cheb_eval と一致する
+ *              * 引数は cheb_eval と同じ（係数の数は N と一致するもののみ渡される）
+ *
+ * @param[in]   係数 (const double*; [要素数][N])
+ * @param[in]   係数の数 (unsigned int; 未使用)
+ * @param[in]   要素数 (unsigned int; 3 以下)
+ * @param[in]   チェビシェフ時間 (double)
+ * @param[ref]  位置 (double[3])
+ * @param[ref]  速度 (double[3])
+ */
+template <unsigned int N>
+static void cheb_fixed_scalar(const double* c, unsigned int,
+                              unsigned int n_item, double tc,
+                              double(&pos)[3], double(&vel)[3]) {
+  static_assert(N >= 2 && N <= kChebMax, "Invalid count of coefficients");
+  cheb_eval_scalar(c, N, n_item, tc, pos, vel);
+}
+
+#ifdef APPARENT_SUN_MOON_CHEB_X86
+template <unsigned int N>
+__attribute__((target("sse2")))
+static void cheb_fixed_sse2(const double* c, unsigned int,
+                            unsigned int n_item, double tc,
+                            double(&pos)[3], double(&vel)[3]) {
+  static_assert(N >= 2 && N <= kChebMax, "Invalid count of coefficients");
+  cheb_eval_sse2(c, N, n_item, tc, pos, vel);
+}
+
+template <unsigned int N>
+__attribute__((target("avx2")))
+static void cheb_fixed_avx2(const double* c, unsigned int,
+                            unsigned int n_item, double tc,
+                            double(&pos)[3], double(&vel)[3]) {
+  static_assert(N >= 2 && N <= kChebMax, "Invalid count of coefficients");
+  cheb_eval_avx2(c, N, n_item, tc, pos, vel);
+}
+#endif
+
+// 特殊化済み評価関数の数
+static constexpr unsigned int kChebFixedCnt = kChebFixedMax - kChebFixedMin + 1;
+// 特殊化済み評価関数一覧の型（[実装][係数の数 - kChebFixedMin]）
+using ChebFixedTable = std::array<std::array<ChebEval, kChebFixedCnt>, 3>;
+
+/*
+ * @brief       特殊化済み評価関数の一覧生成
+ *              * x86 以外では、全実装ともスカラー版
+ *
+ * @param[in]   <none>
+ * @return      評価関数一覧 (ChebFixedTable)
+ */
+template <unsigned int... Ns>
+static constexpr ChebFixedTable gen_fixed_table(
+    std::integer_sequence<unsigned int, Ns...>) {
+#ifdef APPARENT_SUN_MOON_CHEB_X86
+  return ChebFixedTable{{{{cheb_fixed_scalar<kChebFixedMin + Ns>...}},
+                         {{cheb_fixed_sse2<kChebFixedMin + Ns>...}},
+                         {{cheb_fixed_avx2<kChebFixedMin + Ns>...}}}};
+#else
+  return ChebFixedTable{{{{cheb_fixed_scalar<kChebFixedMin + Ns>...}},
+                         {{cheb_fixed_scalar<kChebFixedMin + Ns>...}},
+                         {{cheb_fixed_scalar<kChebFixedMin + Ns>...}}}};
+#endif
+}
+
+/*
+ * @brief   係数の数に応じた評価関数
+ *          * ヘッダ解析時（JplHeader::gen_layouts）に天体ごとに選択しておく
+ *          * 特殊化済みの数は、実行時に判定した実装（get_isa）の展開版
+ *          * 特殊化されていない数は汎用版（cheb_eval）
+ *
+ * @param[in]  係数の数 (unsigned int)
+ * @return     評価関数 (ChebEval)
+ */
+ChebEval cheb_func(unsigned int n) {
+  static constexpr ChebFixedTable kFixed = gen_fixed_table(
+      std::make_integer_sequence<unsigned int, kChebFixedCnt>{});
+
+  if (n < kChebFixedMin || n > kChebFixedMax) { return cheb_eval; }
+  return kFixed[get_isa()][n - kChebFixedMin];
+}
+
+/*
+ * @brief   使用中の実装名
+ *
+ * @param   <none>
+ * @return  実装名 (const char*; "avx2" | "sse2" | "scalar")
+ */
+const char* cheb_isa() {
+  if (get_isa() == kIsaAvx2) { return "avx2"; }
+  if (get_isa() == kIsaSse2) { return "sse2"; }
+  return "scalar";
+}
+
+}  // namespace apparent_sun_moon
+
@@ -0,0 +1,36 @@
+#ifndef APPARENT_SUN_MOON_CHEB_HPP_
+#define APPARENT_SUN_MOON_CHEB_HPP_
+
+namespace apparent_sun_moon {
+
+constexpr unsigned int kChebMax = 32;  // 係数の数の上限
+
+// チェビシェフ多項式の評価（位置・速度(微分)を同時に計算）
+// * 係数は [要素数(最大 3)][係数の数] の並び
+// * 実行時に CPU を判定し、 AVX2 / SSE2 / スカラーの実装を選択する
+//   （SIMD 版はレーンを位置・速度とし、結果はスカラー版と一致する）
+void cheb_eval(const double*, unsigned int, unsigned int, double,
+               double(&)[3], double(&)[3]);
+// チェビシェフ多項式の評価（同一係数・複数時刻; SIMD レーンは時刻方向）
+// * 結果は SoA（位置・速度とも [要素数][時刻数]）
+void cheb_eval_multi(const double*, unsigned int, unsigned int,
+                     const double*, unsigned int,
+                     double* const*, double* const*);
+const char* cheb_isa();  // 使用中の実装名
+
+// 評価関数の型（cheb_eval と同じ引数）
+using ChebEval = void (*)(const double*, unsigned int, unsigned int, double,
+                          double(&)[3], double(&)[3]);
+// 係数の数に応じた評価関数（Jpl::interpolate が使用）
+// * 特殊化済みの数（kChebFixedMin 〜 kChebFixedMax）は、 cheb_eval と同じ
+//   実行時選択の実装（AVX2 / SSE2 / スカラー）のループ展開版、その他は cheb_eval
+// * DE4xx の係数の数（6 〜 14）は全て特殊化済みの範囲のため、実際の暦では
+//   常にループ展開版（AVX2 対応 CPU では AVX2 版）が使用される
+constexpr unsigned int kChebFixedMin = 6;
+constexpr unsigned int kChebFixedMax = 18;
+ChebEval cheb_func(unsigned int);
+
+}  // namespace apparent_sun_moon
+
+#endif
+
@@ -9,66 +9,31 @@ static constexpr char kFNutPl[11]   = "NUT_PL.txt";
 
 /*
  * @brief      UTC - TAI (協定世界時と国際原子時の差 = うるう秒の総和) 一覧取得
+ *             * 日付は日数（1970-01-01 からの通日）の昇順
  *
- * @param[ref] UTC - TAI 一覧(vector<vector<string>>)
+ * @param[ref] 適用開始日の日数一覧(vector<long>)
+ * @param[ref] UTC - TAI 一覧(vector<int>)
  * @return     true|false
  */
-bool File::get_leap_sec_list(std::vector<std::vector<std::string>>& data) {
-  std::string f(kFLeapSec);  // ファイル名
-  std::string buf;           // 1行分バッファ
+bool File::get_leap_sec_list(std::vector<long>& days, std::vector<int>& vals) {
+  std::vector<double> buf;  // 値（読み込み用）
 
-  try {
-    // ファイル OPEN
-    std::ifstream ifs(f);
-    if (!ifs) return 0;  // 読み込み失敗
-
-    // ファイル READ
-    while (getline(ifs, buf)) {
-      std::vector<std::string> rec;  // 1行分ベクタ
-      std::istringstream iss(buf);   // 文字列ストリーム
-      // 1行分文字列を1行分ベクタに追加
-      std::string s;
-      while (iss >> s) rec.push_back(s);
-      // 1行分ベクタを data ベクタに追加
-      if (rec.size() != 0) data.push_back(rec);
-    }
-  } catch (...) {
-    return false;
-  }
+  if (!get_day_list(kFLeapSec, days, buf)) { return false; }
+  vals.assign(buf.begin(), buf.end());
 
   return true;
 }
 
 /*
  * @brief      DUT1 (UT1(世界時1) と UTC(協定世界時)の差) 一覧取得
+ *             * 日付は日数（1970-01-01 からの通日）の昇順
  *
- * @param[ref] DUT1 一覧(vector<vector<string>>)
+ * @param[ref] 適用開始日の日数一覧(vector<long>)
+ * @param[ref] DUT1 一覧(vector<double>)
  * @return     true|false
  */
-bool File::get_dut1_list(std::vector<std::vector<std::string>>& data) {
-  std::string f(kFDut1);  // ファイル名
-  std::string buf;        // 1行分バッファ
-
-  try {
-    // ファイル OPEN
-    std::ifstream ifs(f);
-    if (!ifs) return 0;  // 読み込み失敗
-
-    // ファイル READ
-    while (getline(ifs, buf)) {
-      std::vector<std::string> rec;  // 1行分ベクタ
-      std::istringstream iss(buf);   // 文字列ストリーム
-      // 1行分文字列を1行分ベクタに追加
-      std::string s;
-      while (iss >> s) rec.push_back(s);
-      // 1行分ベクタを data ベクタに追加
-      if (rec.size() != 0) data.push_back(rec);
-    }
-  } catch (...) {
-    return false;
-  }
-
-  return true;
+bool File::get_dut1_list(std::vector<long>& days, std::vector<double>& vals) {
+  return get_day_list(kFDut1, days, vals);
 }
 
 /*
@@ -79,7 +44,19 @@ bool File::get_dut1_list(std::vector<std::vector<std::string>>& data) {
  * @return     true|false
  */
 bool File::get_param_ls(std::vector<std::vector<double>>& data) {
-  std::string f(kFNutLs);  // ファイル名
+  return get_param_ls(data, kFNutLs);
+}
+
+/*
+ * @brief      取得: lunisolar parameters（ファイル指定）
+ *             （第6列以後は 10,000 倍にする）
+ *
+ * @param[ref] lunisolar パラメータ一覧(vector<vector<double>>)
+ * @param[in]  ファイル名 (string)
+ * @return     true|false
+ */
+bool File::get_param_ls(
+    std::vector<std::vector<double>>& data, const std::string& f) {
   std::string buf;         // 1行分バッファ
   unsigned int c;          // ループインデックス（列処理用
 
@@ -119,7 +96,19 @@ bool File::get_param_ls(std::vector<std::vector<double>>& data) {
  * @return     true|false
  */
 bool File::get_param_pl(std::vector<std::vector<double>>& data) {
-  std::string f(kFNutPl);  // ファイル名
+  return get_param_pl(data, kFNutPl);
+}
+
+/*
+ * @brief      取得: planetary parameters（ファイル指定）
+ *             （第15列以後は 10,000 倍にする）
+ *
+ * @param[ref] planetary パラメータ一覧(vector<vector<double>>)
+ * @param[in]  ファイル名 (string)
+ * @return     true|false
+ */
+bool File::get_param_pl(
+    std::vector<std::vector<double>>& data, const std::string& f) {
   std::string buf;         // 1行分バッファ
   unsigned int c;          // ループインデックス（列処理用
 
@@ -151,5 +140,60 @@ bool File::get_param_pl(std::vector<std::vector<double>>& data) {
   return true;
 }
 
+// -------------------------------------
+// 以下、 private functions
+// -------------------------------------
+
+/*
+ * @brief      取得: 日付（YYYYMMDD）と値の一覧
+ *             * 日付は日数（1970-01-01 からの通日）に変換する
+ *             * 日付は昇順（同日の重複は可）であること
+ *
+ * @param[in]  ファイル名 (string)
+ * @param[ref] 日数一覧(vector<long>)
+ * @param[ref] 値一覧(vector<double>)
+ * @return     true|false
+ */
+bool File::get_day_list(const std::string& f, std::vector<long>& days,
+                        std::vector<double>& vals) {
+  std::string  buf;  // 1行分バッファ
+  long         ymd;  // 日付（YYYYMMDD）
+  double       val;  // 値
+  unsigned int m;    // 月
+  unsigned int d;    // 日
+
+  try {
+    // ファイル OPEN
+    std::ifstream ifs(f);
+    if (!ifs) return false;  // 読み込み失敗
+
+    // ファイル READ
+    days.clear();
+    vals.clear();
+    while (getline(ifs, buf)) {
+      std::istringstream iss(buf);  // 文字列ストリーム
+      if (!(iss >> ymd)) continue;  // 空行等
+      m = static_cast<unsigned int>(ymd / 100 % 100);
+      d = static_cast<unsigned int>(ymd % 100);
+      if (!(iss >> val) || m < 1 || m > 12 || d < 1 || d > 31) {
+        std::cout << "[ERROR] " << f << ": invalid line (" << buf << ")"
+                  << std::endl;
+        return false;
+      }
+      days.push_back(days_from_civil(ymd / 10000, m, d));
+      vals.push_back(val);
+      if (days.size() > 1 && days[days.size() - 2] > days.back()) {
+        std::cout << "[ERROR] " << f << ": not in ascending order ("
+                  << buf << ")" << std::endl;
+        return false;
+      }
+    }
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
 }  // namespace apparent_sun_moon
 
@@ -1,7 +1,10 @@
 #ifndef APPARENT_SUN_MOON_FILE_HPP_
 #define APPARENT_SUN_MOON_FILE_HPP_
 
+#include "calendar.hpp"
+
 #include <fstream>
+#include <iostream>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -9,12 +12,18 @@
 namespace apparent_sun_moon {
 
 class File {
+  bool get_day_list(const std::string&, std::vector<long>&, std::vector<double>&);
+                                                                   // 取得: 日付（YYYYMMDD）と値の一覧
 
 public:
-  bool get_leap_sec_list(std::vector<std::vector<std::string>>&);  // 取得: うるう秒一覧
-  bool get_dut1_list(std::vector<std::vector<std::string>>&);      // 取得: DUT1 一覧
+  bool get_leap_sec_list(std::vector<long>&, std::vector<int>&);   // 取得: うるう秒一覧
+  bool get_dut1_list(std::vector<long>&, std::vector<double>&);    // 取得: DUT1 一覧
   bool get_param_ls(std::vector<std::vector<double>>&);            // 取得: lunisolar parameters
+  bool get_param_ls(std::vector<std::vector<double>>&, const std::string&);
+                                                                   // 取得: lunisolar parameters（ファイル指定）
   bool get_param_pl(std::vector<std::vector<double>>&);            // 取得: planetary parameters
+  bool get_param_pl(std::vector<std::vector<double>>&, const std::string&);
+                                                                   // 取得: planetary parameters（ファイル指定）
 };
 
 }  // namespace apparent_sun_moon
@@ -3,34 +3,6 @@
 namespace apparent_sun_moon {
 
 // 定数
-static constexpr char         kFBin[]    = "JPLEPH";        // バイナリファイル名
-static constexpr unsigned int kKsize     = 2036;            // KSIZE
-static constexpr unsigned int kRecl      =    4;            // 1レコード = KSIZE * 4
-                                                            // ヘッダは2レコードで構成
-static constexpr unsigned int kPosTtl    =    0;            // 位置: TTL
-static constexpr unsigned int kPosCnam   =  252;            // 位置: CNAM
-static constexpr unsigned int kPosSs     = 2652;            // 位置: SS
-static constexpr unsigned int kPosNcon   = 2676;            // 位置: NCON
-static constexpr unsigned int kPosAu     = 2680;            // 位置: AU
-static constexpr unsigned int kPosEmrat  = 2688;            // 位置: EMRAT
-static constexpr unsigned int kPosIpt    = 2696;            // 位置: IPT(IPT13以外)
-static constexpr unsigned int kPosNumde  = 2840;            // 位置: NUMDE
-static constexpr unsigned int kPosIpt2   = 2844;            // 位置: IPT13
-static constexpr unsigned int kPosCnam2  = 2856;            // 位置: CNAM2(CNAMの続き)
-static constexpr unsigned int kPosCval   = kKsize * kRecl;  // 位置: CVAL
-static constexpr unsigned int kReclTtl   =   84;            // レコード長: TTL
-static constexpr unsigned int kReclCnam  =    6;            // レコード長: CNAM
-static constexpr unsigned int kReclSs    =    8;            // レコード長: SS
-static constexpr unsigned int kReclNcon  =    4;            // レコード長: NCON
-static constexpr unsigned int kReclAu    =    8;            // レコード長: AU
-static constexpr unsigned int kReclEmrat =    8;            // レコード長: EMRAT
-static constexpr unsigned int kReclIpt   =    4;            // レコード長: IPT
-static constexpr unsigned int kReclNumde =    4;            // レコード長: IPT
-static constexpr unsigned int kReclCval  =    8;            // レコード長: CVAL
-static constexpr unsigned int kCntTtl    =    3;            // 件数: TTL
-static constexpr unsigned int kCntCnam   =  400;            // 件数: CNAM
-static constexpr unsigned int kCntSs     =    3;            // 件数: SS
-static constexpr unsigned int kCntIpt    =   12;            // 件数: IPT（IPT13以外）
 static constexpr unsigned int kKind      =    1;            // 計算区分
                                                             //   0: 計算しない
                                                             //   1: 位置・速度を計算
@@ -45,8 +17,10 @@ static constexpr double       kSecDay    = 86400.0;         // Seconds in a day
  * @param[in]  基準フラグ (bool; optional)
  *             (true: 太陽系重心が基準, false: 太陽が基準)
  */
-Jpl::Jpl(double jd, const bool is_km, const bool is_bary) {
+Jpl::Jpl(double jd, const bool is_km, const bool is_bary)
+    : eph(JplEph::get()), hdr(eph.hdr) {
   this->jd      = jd;
+  this->jd_2    = 0.0;
   this->is_km   = is_km;
   this->is_bary = is_bary;
   unsigned int i;
@@ -54,54 +28,67 @@ Jpl::Jpl(double jd, const bool is_km, const bool is_bary) {
     pos[i] = 0.0;
     vel[i] = 0.0;
   }
-  ifs.open(kFBin, std::ios::binary);
-  if (!ifs) {
-    std::cout << "[ERROR] " << kFBin
-              << " could not be found in this directory!" << std::endl;
-    exit(EXIT_FAILURE);
+}
+
+/*
+ * @brief   バイナリファイル読み込み
+ *          * ヘッダは共有ハンドル（JplEph）で解析済みのため、
+ *            対象レコードのみ取得する
+ *          * 係数はマッピング上のレコードを直接参照する（JplRec::body）
+ *
+ * @param   <none>
+ * @return  <none>
+ */
+void Jpl::read_bin() {
+  try {
+    // レコードインデックス取得
+    idx = static_cast<int>((jd - hdr.sss[0]) + jd_2) / hdr.sss[2];
+    // 係数レコード取得（対象のインデックス分を取得）
+    rec = eph.rec(idx);
+    jds[0] = rec.jds[0];
+    jds[1] = rec.jds[1];
+  } catch (...) {
+    throw;
   }
-  // vector 用メモリ確保
-  ttls.reserve(3);
-  cnams.reserve(800);
-  sss.reserve(3);
-  ipts.reserve(13);
-  cvals.reserve(572);  // DE430 で NCON = 572 であることを前提に
-  coeffs.reserve(13);
 }
 
 /*
- * @brief  デストラクタ
+ * @brief      ユリウス日の再設定
+ *             * 同一レコード内であれば係数レコードはそのまま使用し、
+ *               レコードが変わる場合（または未読込の場合）のみ read_bin する
+ *             * 光行時間の反復計算等、近接した時刻で繰り返し計算する場合に使用
  *
- * @param  <none>
+ * @param[in]  ユリウス日 (double)
+ * @return     <none>
  */
-Jpl::~Jpl() { ifs.close(); }
+void Jpl::set_jd(double jd) {
+  try {
+    set_jd(jd, 0.0);
+  } catch (...) {
+    throw;
+  }
+}
 
 /*
- * @brief   バイナリファイル読み込み
+ * @brief      ユリウス日（2分割）の再設定
+ *             * JD = 日数部 + 日の端数
+ *               （日数部とレコード開始 JD の差は丸め誤差なしに求まるため、
+ *                 レコード内の時刻は日の端数の精度で保持される）
+ *             * レコードの扱いは set_jd(double) と同じ
  *
- * @param   <none>
- * @return  <none>
+ * @param[in]  ユリウス日の日数部 (double; 例: 0h の JD (x.5))
+ * @param[in]  ユリウス日の日の端数 (double)
+ * @return     <none>
  */
-void Jpl::read_bin() {
+void Jpl::set_jd(double jd_1, double jd_2) {
+  unsigned int idx_n;  // レコードインデックス（新）
 
   try {
-    // ヘッダ（1レコード目）
-    get_ttl(ttls);      // TTL  (タイトル)
-    get_cnam(cnams);    // CNAM (定数名)(400+400件)
-    get_ss(sss);        // SS   (ユリウス日(開始,終了),分割日数)
-    get_ncon(ncon);     // NCON (定数の数)
-    get_au(au);         // AU   (天文単位)
-    get_emrat(emrat);   // EMRAT(地球と月の質量比)
-    get_ipt(ipts);      // IPT  (オフセット,係数の数,サブ区間数)(水星〜月の章動,月の秤動)
-    get_numde(numde);   // NUMDE(DEバージョン番号)
-    // ヘッダ（2レコード目）
-    get_cval(cvals);    // CVAL (定数値)
-    // レコードインデックス取得
-    idx = static_cast<int>(jd - sss[0]) / sss[2];
-    // 係数取得（対象のインデックス分を取得）
-    get_coeff(coeffs);  // COEFF（係数）
-    // バイナリファイル CLOSE
-    ifs.close();
+    this->jd   = jd_1;
+    this->jd_2 = jd_2;
+    idx_n = static_cast<int>((jd_1 - hdr.sss[0]) + jd_2) / hdr.sss[2];
+    if (rec.src != nullptr && idx_n == idx) { return; }
+    read_bin();
   } catch (...) {
     throw;
   }
@@ -115,8 +102,34 @@ void Jpl::read_bin() {
  * @return     <none>
  */
 void Jpl::calc_pv(unsigned int t, unsigned int c) {
+  try {
+    calc_pvs(1, &t, c, &pos, &vel);
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief      位置・速度(Positions(Radian), Velocities(Radian/Day)) 計算
+ *             （複数の対象天体を一括計算）
+ *             * 共通して必要な天体（太陽、地球・月の重心、月等）の補間は1回のみ
+ *
+ * @param[in]  対象天体の数 (unsigned int)
+ * @param[in]  天体番号: 対象一覧 (const unsigned int*)
+ * @param[in]  天体番号: 基準 (unsigned int)
+ * @param[out] 位置一覧 (double(*)[3]; 対象天体の数分)
+ * @param[out] 速度一覧 (double(*)[3]; 対象天体の数分)
+ * @return     <none>
+ */
+void Jpl::calc_pvs(
+    unsigned int n, const unsigned int* ts, unsigned int c,
+    double(*p)[3], double(*v)[3]) {
   unsigned int i;
   unsigned int j;
+  unsigned int k;
+  unsigned int t;
+  unsigned int lst[12];   // 計算対象フラグ一覧（対象天体ごと）
+  bool         need_sun;  // 太陽の補間要否
 
   try {
     // 計算結果初期化
@@ -139,11 +152,23 @@ void Jpl::calc_pv(unsigned int t, unsigned int c) {
       }
     }
 
-    // 計算対象フラグ一覧取得
-    get_list(t, c, list);
+    // 計算対象フラグ一覧取得（全対象天体分の和）
+    for (i = 0; i < 12; ++i) { list[i] = 0; }
+    for (k = 0; k < n; ++k) {
+      get_list(ts[k], c, lst);
+      for (i = 0; i < 12; ++i) { list[i] |= lst[i]; }
+    }
 
     // 補間（11: 太陽）
-    interpolate(11, p_sun, v_sun);
+    // （太陽が対象・基準の場合、または、太陽基準で 1:水星〜9:冥王星を計算する場合のみ）
+    need_sun = (c == 11);
+    for (k = 0; k < n; ++k) {
+      if (ts[k] == 11) { need_sun = true; }
+    }
+    for (i = 0; i < 9; ++i) {
+      if (list[i] != 0 && !is_bary) { need_sun = true; }
+    }
+    if (need_sun) { interpolate(11, p_sun, v_sun); }
 
     // 補間（1:水星〜10:月）
     for (i = 0; i < 10; ++i) {
@@ -158,77 +183,75 @@ void Jpl::calc_pv(unsigned int t, unsigned int c) {
     }
 
     // 補間（14:地球の章動）
-    if (list[10] > 0 && ipts[11][1] > 0) {
+    if (list[10] > 0 && hdr.ipts[11][1] > 0) {
       interpolate(14, p_nut, v_nut);
     }
 
     // 補間（15:月の秤動）
-    if (list[11] > 0 && ipts[12][1] > 0) {
+    if (list[11] > 0 && hdr.ipts[12][1] > 0) {
       interpolate(15, ps[10], vs[10]);
     }
 
-    // 対象天体と基準天体の差
-    if (t == 14) {
-      if (ipts[11][1] > 0) {
-        for (i = 0; i < 3; ++i) {
-          pos[i] = p_nut[i];
-          vel[i] = v_nut[i];
-        }
-      }
-    } else if (t == 15) {
-      if (ipts[12][1] > 0) {
-        for (i = 0; i < 3; ++i) {
-          pos[i] = ps[10][i];
-          vel[i] = vs[10][i];
-        }
-      }
-    } else {
-      for (i = 0; i < 10; ++i) {
-        for (j = 0; j < 3; ++j) {
-          ps_2[i][j] = ps[i][j];
-          vs_2[i][j] = vs[i][j];
-        }
+    // 各天体の位置・速度（1:水星〜13:地球・月の重心）
+    for (i = 0; i < 10; ++i) {
+      for (j = 0; j < 3; ++j) {
+        ps_2[i][j] = ps[i][j];
+        vs_2[i][j] = vs[i][j];
       }
-      if (t == 11 || c == 11) {
-        for (i = 0; i < 3; ++i) {
-          ps_2[10][i] = p_sun[i];
-          vs_2[10][i] = v_sun[i];
-        }
+    }
+    for (i = 0; i < 3; ++i) {
+      ps_2[10][i] = p_sun[i];  // 11: 太陽
+      vs_2[10][i] = v_sun[i];
+      ps_2[11][i] = 0.0;       // 12: 太陽系重心
+      vs_2[11][i] = 0.0;
+      ps_2[12][i] = ps[2][i];  // 13: 地球・月の重心
+      vs_2[12][i] = vs[2][i];
+    }
+    if (list[2] != 0) {
+      for (i = 0; i < 3; ++i) {
+        ps_2[2][i] = ps[2][i] - ps[9][i] / (1.0 + hdr.emrat);
+        vs_2[2][i] = vs[2][i] - vs[9][i] / (1.0 + hdr.emrat);
       }
-      if (t == 12 || c == 12) {
-        for (i = 0; i < 3; ++i) {
-          ps_2[11][i] = 0.0;
-          vs_2[11][i] = 0.0;
-        }
+    }
+    if (list[9] != 0) {
+      for (i = 0; i < 3; ++i) {
+        ps_2[9][i] = ps_2[2][i] + ps[9][i];
+        vs_2[9][i] = vs_2[2][i] + vs[9][i];
       }
-      if (t == 13 || c == 13) {
-        for (i = 0; i < 3; ++i) {
-          ps_2[12][i] = ps[2][i];
-          vs_2[12][i] = vs[2][i];
-        }
+    }
+
+    // 対象天体と基準天体の差
+    for (k = 0; k < n; ++k) {
+      t = ts[k];
+      for (i = 0; i < 3; ++i) {
+        p[k][i] = 0.0;
+        v[k][i] = 0.0;
       }
-      if (t * c == 30 || t + c == 13) {
-        for (i = 0; i < 3; ++i) {
-          ps_2[2][i] = 0.0;
-          vs_2[2][i] = 0.0;
-        }
-      } else {
-        if (list[2] != 0) {
+      if (t == 14) {
+        if (hdr.ipts[11][1] > 0) {
           for (i = 0; i < 3; ++i) {
-            ps_2[2][i] = ps[2][i] - ps[9][i] / (1.0 + emrat);
-            vs_2[2][i] = vs[2][i] - vs[9][i] / (1.0 + emrat);
+            p[k][i] = p_nut[i];
+            v[k][i] = v_nut[i];
           }
         }
-        if (list[9] != 0) {
+      } else if (t == 15) {
+        if (hdr.ipts[12][1] > 0) {
           for (i = 0; i < 3; ++i) {
-            ps_2[9][i] = ps_2[2][i] + ps[9][i];
-            vs_2[9][i] = vs_2[2][i] + vs[9][i];
+            p[k][i] = ps[10][i];
+            v[k][i] = vs[10][i];
           }
         }
-      }
-      for (i = 0; i < 3; ++i) {
-        pos[i] = ps_2[t - 1][i] - ps_2[c - 1][i];
-        vel[i] = vs_2[t - 1][i] - vs_2[c - 1][i];
+      } else if (t * c == 30 && t + c == 13) {
+        // 地球と月の組み合わせは、月の地心位置・速度をそのまま使用
+        for (i = 0; i < 3; ++i) {
+          p[k][i] = (t == 10) ? ps[9][i] : -ps[9][i];
+          v[k][i] = (t == 10) ? vs[9][i] : -vs[9][i];
+        }
+      } else {
+        for (i = 0; i < 3; ++i) {
+          p[k][i] = ps_2[t - 1][i] - ps_2[c - 1][i];
+          v[k][i] = vs_2[t - 1][i] - vs_2[c - 1][i];
+        }
       }
     }
   } catch (...) {
@@ -237,336 +260,199 @@ void Jpl::calc_pv(unsigned int t, unsigned int c) {
 }
 
 /*
- * @brief       取得: TTL
- *              - 84 byte * 3
- *
- * @param[ref]  TTL 一覧 (vector<string>)
- */
-void Jpl::get_ttl(std::vector<std::string>& ttls) {
-  try {
-    get_str_list(kPosTtl, kReclTtl, kCntTtl, ttls);
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: CNAM
- *              - 6 byte * (400 + 400)
- *
- * @param[ref]  CNAM 一覧 (vector<string>)
- */
-void Jpl::get_cnam(std::vector<std::string>& cnams) {
-  std::vector<std::string> cnam2s;   // CNAM2 (6 byte * 400)
-
-  try {
-    get_str_list(kPosCnam,  kReclCnam, kCntCnam, cnams );  // 最初の400件
-    get_str_list(kPosCnam2, kReclCnam, kCntCnam, cnam2s);  // 後部の400件
-    std::copy(cnam2s.begin(), cnam2s.end(), std::back_inserter(cnams));
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: SS
- *              - 8 byte * 3
- *
- * @param[ref]  SS 一覧 (vector<double>)
- */
-void Jpl::get_ss(std::vector<double>& sss) {
-  try {
-    get_dbl_list(kPosSs, kReclSs, kCntSs, sss);
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: NCON
- *              - 4 byte * 1
- *
- * @param[ref]  NCON (unsigned int)
- */
-void Jpl::get_ncon(unsigned int& ncon) {
-  try {
-    get_val<unsigned int>(kPosNcon, kReclNcon, ncon);
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: AU
- *              - 8 byte * 1
- *
- * @param[ref]  AU (double)
- */
-void Jpl::get_au(double& au) {
-  try {
-    get_val<double>(kPosAu, kReclAu, au);
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: EMRAT
- *              - 8 byte * 1
- *
- * @param[ref]  EMRAT (double)
- */
-void Jpl::get_emrat(double& emrat) {
-  try {
-    get_val<double>(kPosEmrat, kReclEmrat, emrat);
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: NUMDE
- *              - 4 byte * 1
- *
- * @param[ref]  NUMDE (unsigned int)
- */
-void Jpl::get_numde(unsigned int& numde) {
-  try {
-    get_val<unsigned int>(kPosNumde, kReclNumde, numde);
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: IPT
+ * @brief       計算対象フラグ一覧（係数データの並びに対応）取得
+ *              （計算区分 0: 計算しない、1: 位置・速度を計算）
  *
- * @param[ref]  値一覧 (vector<vector<unsigned int>>)
+ * @param[in]   天体番号: 対象 (unsigned int)
+ * @param[in]   天体番号: 基準 (unsigned int)
+ * @param[ref]  計算対象フラグ一覧 (unsigned int[12])
  */
-void Jpl::get_ipt(std::vector<std::vector<unsigned int>>& vals) {
+void Jpl::get_list(unsigned int t, unsigned int c, unsigned int(&list)[12]) {
   unsigned int i;
-  unsigned int j;
-  unsigned int pos  = kPosIpt;
-  unsigned int recl = kReclIpt;
-  std::vector<unsigned int> ary;
-  unsigned int buf;
 
   try {
-    // IPT13 以外
-    for (i = 0; i < kCntIpt; ++i) {
-      ary.clear();
-      for (j = 0; j < 3; ++j) {
-        ifs.seekg(pos);
-        ifs.read((char*)&buf, recl);
-        ary.push_back(buf);
-        pos += recl;
-      }
-      vals.push_back(ary);
+    for (i = 0; i < 12; ++i) { list[i] = 0; }  // 0 で初期化
+    if (t == 14) {
+      if (hdr.ipts[11][1] > 0) { list[10] = kKind; }
+      return;
     }
-    // IPT13
-    ary.clear();
-    pos = kPosIpt2;
-    for (j = 0; j < 3; ++j) {
-      ifs.seekg(pos);
-      ifs.read((char*)&buf, recl);
-      ary.push_back(buf);
-      pos += recl;
+    if (t == 15) {
+      if (hdr.ipts[12][1] > 0) { list[11] = kKind; }
+      return;
     }
-    vals.push_back(ary);
+    if (t <= 10) { list[t - 1] = kKind; }
+    if (t == 10) { list[2]     = kKind; }
+    if (t ==  3) { list[9]     = kKind; }
+    if (t == 13) { list[2]     = kKind; }
+    if (c <= 10) { list[c - 1] = kKind; }
+    if (c == 10) { list[2]     = kKind; }
+    if (c ==  3) { list[9]     = kKind; }
+    if (c == 13) { list[2]     = kKind; }
   } catch (...) {
     throw;
   }
 }
 
 /*
- * @brief       取得: CVAL
- *              - 8 byte * NCON
+ * @brief       位置・速度計算（1天体・複数時刻一括）
+ *              * 各時刻を (レコード, サブ区間) 単位にまとめ、
+ *                グループごとに係数を1回だけ取得して SIMD で評価
+ *                （cheb_eval_multi; レーンは時刻方向）
+ *              * 時刻の並びは任意（昇順であれば並べ替えは省略）
+ *              * 結果は補間値そのもの（3 のみ算出値）
+ *                （1, 2, 4〜9, 11: 太陽系重心基準,
+ *                  3: 地球（太陽系重心基準; calc_pv と同様に
+ *                     地球・月の重心と月から算出）,
+ *                  10: 地球基準の月, 13: 地球・月の重心（太陽系重心基準）,
+ *                  14: 地球の章動, 15: 月の秤動）
  *
- * @param[ref]  CVAL 一覧 (vector<double>)
+ * @param[in]   天体番号 (unsigned int; 1 〜 11, 13 〜 15)
+ * @param[in]   時刻数 (unsigned int)
+ * @param[in]   ユリウス日 (const double*; [時刻数])
+ * @param[out]  位置 (double* const*; [3][時刻数])
+ * @param[out]  速度 (double* const*; [3][時刻数])
+ *              * 14（地球の章動）の場合は [2][時刻数]
+ * @param[in]   単位フラグ (bool; optional)
+ *              (true: km, km/sec, false: AU, AU/day)
  */
-void Jpl::get_cval(std::vector<double>& cvals) {
+void Jpl::calc_pv_batch(
+    unsigned int astr, unsigned int n, const double* jds_b,
+    double* const* pos, double* const* vel, const bool is_km) {
   try {
-    get_dbl_list(kPosCval, kReclCval, ncon, cvals);
+    calc_pv_batch(astr, n, jds_b, nullptr, pos, vel, is_km);
   } catch (...) {
     throw;
   }
 }
 
 /*
- * @brief       取得: COEFF
- *              - 8 byte * ?
- *              - 地球・章動のみ要素数が 2 で、その他の要素数は 3
+ * @brief       位置・速度計算（1天体・複数時刻一括; JD 2分割）
+ *              * JD = 日数部 + 日の端数 とし、レコード内の時刻は
+ *                (日数部 - レコード開始 JD) + 日の端数 で求める
+ *              * その他は calc_pv_batch（JD 1分割）と同じ
  *
- * @param[ref]  値一覧 (vector<vector<vector<vector<double>>>>)
+ * @param[in]   天体番号 (unsigned int; 1 〜 11, 13 〜 15)
+ * @param[in]   時刻数 (unsigned int)
+ * @param[in]   ユリウス日の日数部 (const double*; [時刻数])
+ * @param[in]   ユリウス日の日の端数 (const double*; [時刻数]; nullptr: 全て 0.0)
+ * @param[out]  位置 (double* const*; [3][時刻数])
+ * @param[out]  速度 (double* const*; [3][時刻数])
+ *              * 14（地球の章動）の場合は [2][時刻数]
+ * @param[in]   単位フラグ (bool; optional)
+ *              (true: km, km/sec, false: AU, AU/day)
  */
-void Jpl::get_coeff(
-    std::vector<std::vector<std::vector<std::vector<double>>>>& vals) {
+void Jpl::calc_pv_batch(
+    unsigned int astr, unsigned int n, const double* jds_b,
+    const double* jd_2s, double* const* pos, double* const* vel,
+    const bool is_km) {
+  const JplEph&    eph    = JplEph::get();
+  const JplHeader& hdr    = eph.hdr;
+  unsigned int     n_item = 3;         // 要素数
+  unsigned int     i_ipt  = astr - 1;  // インデックス（ipts 用）
+  JplRec                     rec;      // 係数レコード（直前の時刻）
+  std::vector<unsigned long> keys(n);  // グループキー（レコード, サブ区間）
+  std::vector<unsigned int>  ords(n);  // 評価順（キー順）
+  std::vector<unsigned int>  idxs(n);  // レコードインデックス
+  std::vector<double>        tcs(n);   // チェビシェフ時間
+  std::vector<double>        wk(n * 7);
+                                       // 作業領域（チェビシェフ時間, 位置, 速度）
+  double*      p_wk[3];                // 作業領域: 位置
+  double*      v_wk[3];                // 作業領域: 速度
+  const double* c;                     // 係数（当該サブ区間の先頭）
+  double       f_v;                    // 速度の換算係数（d/dtc -> d/dt）
+  double       tc;
+  double       tmp;
+  double       dd;                     // 日の端数
+  double       p;
+  double       v;
+  unsigned int idx;
+  unsigned int idx_l = 0;
+  unsigned int idx_s;
+  unsigned int e;
+  unsigned int g;
+  unsigned int m;
   unsigned int i;
-  unsigned int j;
-  unsigned int k;
-  unsigned int l;
-  double buf;
-  std::vector<double> ary_a;                 // 該当インデックス分全て
-  std::vector<double> ary;                   // 該当惑星分のみ
-  std::vector<double> ary_w_1;               // 作業用
-  std::vector<std::vector<double>> ary_w_2;  // 作業用
-  std::vector<std::vector<std::vector<double>>> ary_p;  // 作業用
-  unsigned int offset;
-  unsigned int cnt_coeff;
-  unsigned int cnt_sub;
-  unsigned int n;
-  unsigned int pos  = kKsize * kRecl * (2 + idx);
-  unsigned int recl = 8;
 
   try {
-    // 該当インデックス分全て取得
-    for (i = 0; i < kKsize / 2; ++i) {
-      ifs.seekg(pos);
-      ifs.read((char*)&buf, recl);
-      ary_a.push_back(buf);
-      pos += recl;
+    if (astr == 0 || astr == 12 || astr > 15) {
+      throw "[ERROR] Invalid astro number!";
     }
-
-    // Julian Day (start, end)
-    for (i = 0; i < 2; ++i) { jds[i] = ary_a[i]; }
-
-    // 全惑星分
-    for (i = 0; i < 13; ++i) {
-      // 該当惑星分のみ抽出
-      offset    = ipts[i][0];
-      cnt_coeff = ipts[i][1];
-      cnt_sub   = ipts[i][2];
-      n = 3;
-      if ((i + 1) == 12) { n = 2; }
-      ary.clear();
-      for (j = offset - 1; j < offset - 1 + cnt_coeff * n * cnt_sub; ++j) {
-        ary.push_back(ary_a[j]);
+    // 3: 地球 = 地球・月の重心 - 月（地球基準） / (1 + EMRAT)
+    if (astr == 3) {
+      std::vector<double> wk_m(n * 6);  // 月（地球基準）の位置・速度
+      double*             p_m[3];
+      double*             v_m[3];
+      for (i = 0; i < 3; ++i) {
+        p_m[i] = wk_m.data() + n * i;
+        v_m[i] = wk_m.data() + n * (i + 3);
       }
-
-      // 3次元配列化
-      // [サブ区間数, 要素数(3 or 2), 係数の数]
-      ary_p.clear();
-      for (j = 0; j < ary.size() / (cnt_coeff * n); ++j) {
-        ary_w_2.clear();
-        for (k = 0; k < n; ++k) {
-          ary_w_1.clear();
-          for (l = 0; l < cnt_coeff; ++l) {
-            ary_w_1.push_back(ary[j * cnt_coeff * n + k * cnt_coeff + l]);
-          }
-          ary_w_2.push_back(ary_w_1);
+      calc_pv_batch(13, n, jds_b, jd_2s, pos, vel, is_km);
+      calc_pv_batch(10, n, jds_b, jd_2s, p_m, v_m, is_km);
+      for (i = 0; i < 3; ++i) {
+        for (e = 0; e < n; ++e) {
+          pos[i][e] = pos[i][e] - p_m[i][e] / (1.0 + hdr.emrat);
+          vel[i][e] = vel[i][e] - v_m[i][e] / (1.0 + hdr.emrat);
         }
-        ary_p.push_back(ary_w_2);
       }
-      vals.push_back(ary_p);
+      return;
     }
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: (unsigned int|double) 型 1件 template
- *
- * @param[in]   レコード位置 (unsigned int)
- * @param[in]   レコード長 (unsigned int)
- * @param[ref]  値 (class T)
- */
-template <class T>
-void Jpl::get_val(unsigned int pos, unsigned int recl, T& val) {
-  try {
-    ifs.seekg(pos);
-    ifs.read((char*)&val, recl);
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: vector<double> 型
- *
- * @param[in]   レコード位置 (unsigned int)
- * @param[in]   レコード長 (unsigned int)
- * @param[in]   件数 (unsigned int)
- * @param[ref]  値一覧 (vector<double>)
- */
-void Jpl::get_dbl_list(
-    unsigned int pos, unsigned int recl, unsigned int cnt,
-    std::vector<double>& vals) {
-  unsigned int i;
-  double       buf;
-
-  try {
-    for (i = 0; i < cnt; ++i) {
-      ifs.seekg(pos);
-      ifs.read((char*)&buf, recl);
-      vals.push_back(buf);
-      pos += recl;
+    if (astr == 14) { n_item = 2; }
+    if (astr == 13) { i_ipt = 2; }  // 地球・月の重心（係数は 3 の並び）
+    if (astr > 13) { i_ipt = astr - 3; }
+    const JplLayout& lay = hdr.lays[i_ipt];
+    f_v = 2.0 * lay.cnt_sub / hdr.sss[2];
+
+    // レコード・サブ区間・チェビシェフ時間（Jpl::norm_time と同じ計算）
+    for (e = 0; e < n; ++e) {
+      dd  = (jd_2s != nullptr) ? jd_2s[e] : 0.0;
+      idx = static_cast<int>((jds_b[e] - hdr.sss[0]) + dd) / hdr.sss[2];
+      if (rec.src == nullptr || idx != idx_l) {
+        rec   = eph.rec(idx);
+        idx_l = idx;
+      }
+      idxs[e] = idx;
+      tc  = ((jds_b[e] - rec.jds[0]) + dd) / hdr.sss[2];
+      tmp = tc * lay.cnt_sub;
+      idx_s = static_cast<int>(tmp - static_cast<int>(tc));
+      tcs[e]  = (fmod(tmp, 1.0) + static_cast<int>(tc)) * 2 - 1;
+      keys[e] = static_cast<unsigned long>(idx) * lay.cnt_sub + idx_s;
+      ords[e] = e;
     }
-  } catch (...) {
-    throw;
-  }
-}
-
-/*
- * @brief       取得: vector<string> 型
- *              (後のスペースは trim)
- *
- * @param[in]   レコード位置 (unsigned int)
- * @param[in]   レコード長 (unsigned int)
- * @param[in]   件数 (unsigned int)
- * @param[ref]  値一覧 (vector<string>)
- */
-void Jpl::get_str_list(
-    unsigned int pos, unsigned int recl, unsigned int cnt,
-    std::vector<std::string>& vals) {
-  unsigned int i;
-  char*        buf;
-  std::string  str;
-
-  try {
-    for (i = 0; i < cnt; ++i) {
-      ifs.seekg(pos);
-      buf = new char[recl];
-      ifs.read(buf, recl);
-      str = buf;
-      vals.push_back(str.erase(str.find_last_not_of(" ") + 1));
-      pos += recl;
-      delete buf;
+    if (!std::is_sorted(keys.begin(), keys.end())) {
+      std::stable_sort(ords.begin(), ords.end(),
+          [&keys](unsigned int a, unsigned int b) {
+            return keys[a] < keys[b];
+          });
     }
-  } catch (...) {
-    throw;
-  }
-}
 
-/*
- * @brief       計算対象フラグ一覧（係数データの並びに対応）取得
- *              （計算区分 0: 計算しない、1: 位置・速度を計算）
- *
- * @param[in]   天体番号: 対象 (unsigned int)
- * @param[in]   天体番号: 基準 (unsigned int)
- * @param[ref]  計算対象フラグ一覧 (unsigned int[12])
- */
-void Jpl::get_list(unsigned int t, unsigned int c, unsigned int(&list)[12]) {
-  unsigned int i;
-
-  try {
-    for (i = 0; i < 12; ++i) { list[i] = 0; }  // 0 で初期化
-    if (t == 14) {
-      if (ipts[11][1] > 0) { list[10] = kKind; }
-      return;
+    // グループ単位で評価
+    for (i = 0; i < 3; ++i) {
+      p_wk[i] = wk.data() + n * (i + 1);
+      v_wk[i] = wk.data() + n * (i + 4);
     }
-    if (t == 15) {
-      if (ipts[12][1] > 0) { list[11] = kKind; }
-      return;
+    for (g = 0; g < n; g += m) {
+      for (m = 0; g + m < n && keys[ords[g + m]] == keys[ords[g]]; ++m) {
+        wk[m] = tcs[ords[g + m]];
+      }
+      e     = ords[g];
+      idx_s = keys[e] - static_cast<unsigned long>(idxs[e]) * lay.cnt_sub;
+      c = eph.rec(idxs[e]).body(lay) + idx_s * n_item * lay.cnt_coeff;
+      cheb_eval_multi(c, lay.cnt_coeff, n_item, wk.data(), m, p_wk, v_wk);
+
+      // 単位の換算、元の並びへ格納
+      for (i = 0; i < n_item; ++i) {
+        for (e = 0; e < m; ++e) {
+          p = p_wk[i][e];
+          v = v_wk[i][e] * f_v;
+          if (astr < 14) {
+            if (!is_km) { p /= hdr.au; }
+            if (is_km) { v /= kSecDay; } else { v /= hdr.au; }
+          }
+          pos[i][ords[g + e]] = p;
+          vel[i][ords[g + e]] = v;
+        }
+      }
     }
-    if (t <= 10) { list[t - 1] = kKind; }
-    if (t == 10) { list[2]     = kKind; }
-    if (t ==  3) { list[9]     = kKind; }
-    if (t == 13) { list[2]     = kKind; }
-    if (c <= 10) { list[t - 1] = kKind; }
-    if (c == 10) { list[2]     = kKind; }
-    if (c ==  3) { list[9]     = kKind; }
-    if (c == 13) { list[2]     = kKind; }
   } catch (...) {
     throw;
   }
@@ -594,58 +480,29 @@ void Jpl::interpolate(
     unsigned int astr, double(&pos)[3], double(&vel)[3]) {
   unsigned int n_item = 3;         // 要素数
   unsigned int i_ipt  = astr - 1;  // インデックス（ipts 用）
-  unsigned int i_coef = astr - 1;  // インデックス（coeffs 用）
-  std::vector<double> wk_pos;      // 作業用 vector （位置）
-  std::vector<double> wk_vel;      // 作業用 vector （速度）
-  unsigned int        s;           // 作業用 vector サイズ
-  double              v;           // 作業用
-  unsigned int        i;           // ループインデックス
-  unsigned int        j;           // ループインデックス
+  const double* c;                 // 係数（当該サブ区間の先頭）
+  double        f_v;               // 速度の換算係数（d/dtc -> d/dt）
+  unsigned int  i;                 // ループインデックス
 
   try {
     // チェビシェフ時間、サブインデックス等
     norm_time(astr, tc, idx_s);
     if (astr == 14) { n_item = 2; }
-    if (astr > 13) {
-      i_ipt  = astr - 3;
-      i_coef = astr - 3;
-    }
+    if (astr > 13) { i_ipt = astr - 3; }
+    const JplLayout& lay = hdr.lays[i_ipt];
+    c = rec.body(lay) + idx_s * n_item * lay.cnt_coeff;
 
-    // 位置
-    wk_pos.push_back(1.0);
-    wk_pos.push_back(tc);
-    for (i = 2; i < ipts[i_ipt][1]; ++i) {
-      s = wk_pos.size();
-      wk_pos.push_back(2.0 * tc * wk_pos[s - 1] - wk_pos[s - 2]);
-    }
-    for (i = 0; i < n_item; ++i) {
-      v = 0;
-      for (j = 0; j < ipts[i_ipt][1]; ++j) {
-        v += coeffs[i_coef][idx_s][i][j] * wk_pos[j];
-      }
-      if (!is_km && astr < 14) { v /= au; }
-      pos[i] = v;
-    }
+    // 位置・速度（チェビシェフ多項式の評価）
+    lay.eval(c, lay.cnt_coeff, n_item, tc, pos, vel);
 
-    // 速度
-    wk_vel.push_back(0.0);
-    wk_vel.push_back(1.0);
-    wk_vel.push_back(2.0 * 2.0 * tc);
-    for (i = 3; i < ipts[i_ipt][1]; ++i) {
-      s = wk_vel.size();
-      wk_vel.push_back(
-          2.0 * tc * wk_vel[s - 1] + 2.0 * wk_pos[i - 1] - wk_vel[s - 2]);
-    }
+    // 単位の換算
+    f_v = 2.0 * lay.cnt_sub / hdr.sss[2];
     for (i = 0; i < n_item; ++i) {
-      v = 0;
-      for (j = 0; j < ipts[i_ipt][1]; ++j) {
-        v += coeffs[i_coef][idx_s][i][j] * wk_vel[j] * 2.0 * ipts[i_ipt][2]
-           / sss[2];
-      }
+      vel[i] *= f_v;
       if (astr < 14) {
-        if (is_km) { v /= kSecDay; } else { v /= au; }
+        if (!is_km) { pos[i] /= hdr.au; }
+        if (is_km) { vel[i] /= kSecDay; } else { vel[i] /= hdr.au; }
       }
-      vel[i] = v;
     }
   } catch (...) {
     throw;
@@ -665,8 +522,8 @@ void Jpl::norm_time(unsigned int astr, double& tc, unsigned int& idx_s) {
   try {
     idx_s = astr;
     if (astr > 13) { idx_s = astr - 2; }
-    tc = (jd - jds[0]) / sss[2];
-    tmp = tc * ipts[idx_s - 1][2];
+    tc = ((jd - jds[0]) + jd_2) / hdr.sss[2];
+    tmp = tc * hdr.ipts[idx_s - 1][2];
     idx_s = static_cast<int>(tmp - static_cast<int>(tc));
     tc = (fmod(tmp, 1.0) + static_cast<int>(tc)) * 2 - 1;
   } catch (...) {
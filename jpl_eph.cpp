@@ -0,0 +1,143 @@
+#include "jpl_eph.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace apparent_sun_moon {
+
+// 定数
+static constexpr char         kFBin[] = "JPLEPH";  // バイナリファイル名
+static constexpr unsigned int kRecl   = JplHeader::kKsize * 4;
+                                                   // 1レコードのサイズ (byte)
+
+/*
+ * @brief  コンストラクタ
+ *         * JPLEPH をメモリマップし、ヘッダ（先頭2レコード）を解析する
+ *
+ * @param  <none>
+ */
+JplEph::JplEph()
+    : size(0), base(map_file(size)), hdr(base),
+      n_rec(size / kRecl - 2), n_dbl(JplHeader::kKsize / 2) {}
+
+/*
+ * @brief  デストラクタ
+ *
+ * @param  <none>
+ */
+JplEph::~JplEph() {
+  if (base != nullptr) { munmap(const_cast<char*>(base), size); }
+}
+
+/*
+ * @brief   取得: 共有ハンドル
+ *          * 初回呼び出し時にファイルをマップ（以後は同じものを返却）
+ *
+ * @param   <none>
+ * @return  ハンドル (const JplEph&)
+ */
+const JplEph& JplEph::get() {
+  static JplEph eph;
+
+  return eph;
+}
+
+/*
+ * @brief      取得: 係数レコード先頭
+ *             * 1レコード = KSIZE / 2 件の double
+ *             * 先頭2件は JD (開始、終了)
+ *
+ * @param[in]  レコードインデックス (unsigned int)
+ * @return     レコード先頭 (const double*)
+ */
+const double* JplEph::record(unsigned int idx) const {
+  if (idx >= n_rec) { throw "[ERROR] JD is out of range of JPLEPH!"; }
+
+  return reinterpret_cast<const double*>(base + kRecl * (2 + idx));
+}
+
+/*
+ * @brief      取得: 係数レコード
+ *             * マッピング上のレコードを直接参照する（複製しない）
+ *
+ * @param[in]  レコードインデックス (unsigned int)
+ * @return     係数レコード (JplRec)
+ */
+JplRec JplEph::rec(unsigned int idx) const {
+  try {
+    return JplRec(record(idx));
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief      コンストラクタ（未読込）
+ */
+JplRec::JplRec() : src(nullptr) {
+  jds[0] = 0.0;
+  jds[1] = 0.0;
+}
+
+/*
+ * @brief      コンストラクタ
+ *
+ * @param[in]  レコード先頭（マッピング上） (const double*)
+ */
+JplRec::JplRec(const double* src) : src(src) {
+  jds[0] = src[0];
+  jds[1] = src[1];
+}
+
+/*
+ * @brief      取得: 天体の係数
+ *             * マッピング上のレコードを直接参照する
+ *
+ * @param[in]  係数の配置 (JplLayout)
+ * @return     当該天体の係数先頭 (const double*)
+ */
+const double* JplRec::body(const JplLayout& lay) const {
+  return src + lay.offset;
+}
+
+// -------------------------------------
+// 以下、 private functions
+// -------------------------------------
+
+/*
+ * @brief       ファイルのメモリマップ
+ *
+ * @param[ref]  マッピングサイズ (size_t)
+ * @return      マッピング先頭アドレス (const char*)
+ */
+const char* JplEph::map_file(std::size_t& size) {
+  int         fd;
+  struct stat st;
+  void*       p;
+
+  fd = open(kFBin, O_RDONLY);
+  if (fd < 0) {
+    std::cout << "[ERROR] " << kFBin
+              << " could not be found in this directory!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  if (fstat(fd, &st) != 0 || st.st_size < 2 * kRecl) {
+    std::cout << "[ERROR] " << kFBin << " is not valid!" << std::endl;
+    close(fd);
+    exit(EXIT_FAILURE);
+  }
+  size = static_cast<std::size_t>(st.st_size);
+  p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // マッピング後はファイルディスクリプタ不要
+  if (p == MAP_FAILED) {
+    std::cout << "[ERROR] " << kFBin << " could not be mapped!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  return static_cast<const char*>(p);
+}
+
+}  // namespace apparent_sun_moon
+
@@ -0,0 +1,52 @@
+#ifndef APPARENT_SUN_MOON_JPL_EPH_HPP_
+#define APPARENT_SUN_MOON_JPL_EPH_HPP_
+
+#include "jpl_header.hpp"
+
+#include <cstddef>
+#include <cstdlib>   // for EXIT_XXXX
+#include <iostream>
+
+namespace apparent_sun_moon {
+
+// 係数レコード（マッピング上のレコードの参照）
+// * JPLEPH はネイティブのバイトオーダーの double 列であり変換は不要のため、
+//   係数はマッピング上のレコードを直接参照する（複製しない）。
+// * マッピング（JplEph）はプロセス終了まで保持されるため、参照は常に有効。
+struct JplRec {
+  double        jds[2];                   // JD (開始、終了)
+  const double* src;                      // COEFF（マッピング上のレコード先頭）
+                                          // 各天体・サブ区間・要素の位置は JplLayout で算出
+
+  JplRec();                               // コンストラクタ（未読込）
+  explicit JplRec(const double*);         // コンストラクタ
+  const double* body(const JplLayout&) const;  // 取得: 天体の係数
+};
+
+// JPLEPH バイナリファイルのハンドル（プロセス内で共有、読み込み専用）
+// * ファイルはメモリマップし、ヘッダの解析はプロセス内で1回のみ行う。
+// * Jpl の各インスタンスはマッピングを借用する（ファイルは所有しない）。
+class JplEph {
+  std::size_t size;   // マッピングサイズ
+  const char* base;   // マッピング先頭アドレス
+
+  JplEph();                                     // コンストラクタ（非公開）
+  ~JplEph();                                    // デストラクタ
+  JplEph(const JplEph&) = delete;
+  JplEph& operator=(const JplEph&) = delete;
+  static const char* map_file(std::size_t&);    // ファイルのメモリマップ
+
+public:
+  const JplHeader hdr;                          // ヘッダ（解析済み）
+  unsigned int    n_rec;                        // 係数レコード数
+  unsigned int    n_dbl;                        // 1レコードの件数 (KSIZE / 2)
+
+  static const JplEph& get();                   // 取得: 共有ハンドル
+  const double* record(unsigned int) const;     // 取得: 係数レコード先頭
+  JplRec        rec(unsigned int) const;        // 取得: 係数レコード
+};
+
+}  // namespace apparent_sun_moon
+
+#endif
+
@@ -0,0 +1,219 @@
+#include "jpl_header.hpp"
+
+#include <cstring>
+
+namespace apparent_sun_moon {
+
+// 定数
+static constexpr unsigned int kRecl      =    4;            // 1レコード = KSIZE * 4
+                                                            // ヘッダは2レコードで構成
+static constexpr unsigned int kPosTtl    =    0;            // 位置: TTL
+static constexpr unsigned int kPosCnam   =  252;            // 位置: CNAM
+static constexpr unsigned int kPosSs     = 2652;            // 位置: SS
+static constexpr unsigned int kPosNcon   = 2676;            // 位置: NCON
+static constexpr unsigned int kPosAu     = 2680;            // 位置: AU
+static constexpr unsigned int kPosEmrat  = 2688;            // 位置: EMRAT
+static constexpr unsigned int kPosIpt    = 2696;            // 位置: IPT(IPT13以外)
+static constexpr unsigned int kPosNumde  = 2840;            // 位置: NUMDE
+static constexpr unsigned int kPosIpt2   = 2844;            // 位置: IPT13
+static constexpr unsigned int kPosCnam2  = 2856;            // 位置: CNAM2(CNAMの続き)
+static constexpr unsigned int kPosCval   = JplHeader::kKsize * kRecl;
+                                                            // 位置: CVAL
+static constexpr unsigned int kReclTtl   =   84;            // レコード長: TTL
+static constexpr unsigned int kReclCnam  =    6;            // レコード長: CNAM
+static constexpr unsigned int kReclSs    =    8;            // レコード長: SS
+static constexpr unsigned int kReclIpt   =    4;            // レコード長: IPT
+static constexpr unsigned int kReclCval  =    8;            // レコード長: CVAL
+static constexpr unsigned int kCntTtl    =    3;            // 件数: TTL
+static constexpr unsigned int kCntCnam   =  400;            // 件数: CNAM
+static constexpr unsigned int kCntSs     =    3;            // 件数: SS
+static constexpr unsigned int kCntIpt    =   12;            // 件数: IPT（IPT13以外）
+static constexpr unsigned int kMaxCval   = (JplHeader::kKsize * kRecl) / kReclCval;
+                                                            // 最大件数: CVAL（2レコード目に収まる件数）
+
+/*
+ * @brief      コンストラクタ
+ *             * ヘッダ2レコード分のバッファを解析
+ *
+ * @param[in]  バッファ (const char*; JplHeader::kSize byte)
+ */
+JplHeader::JplHeader(const char* buf) {
+  std::vector<std::string> cnam2s;   // CNAM2 (6 byte * 400)
+
+  try {
+    // vector 用メモリ確保
+    ttls.reserve(kCntTtl);
+    cnams.reserve(kCntCnam * 2);
+    sss.reserve(kCntSs);
+    ipts.reserve(13);
+    lays.reserve(13);
+    // ヘッダ（1レコード目）
+    get_str_list(buf, kPosTtl,   kReclTtl,  kCntTtl,  ttls  );  // TTL  (タイトル)
+    get_str_list(buf, kPosCnam,  kReclCnam, kCntCnam, cnams );  // CNAM (定数名)(最初の400件)
+    get_str_list(buf, kPosCnam2, kReclCnam, kCntCnam, cnam2s);  // CNAM (定数名)(後部の400件)
+    std::copy(cnam2s.begin(), cnam2s.end(), std::back_inserter(cnams));
+    get_dbl_list(buf, kPosSs, kReclSs, kCntSs, sss);  // SS   (ユリウス日(開始,終了),分割日数)
+    get_val<unsigned int>(buf, kPosNcon, ncon);       // NCON (定数の数)
+    get_val<double>(buf, kPosAu, au);                 // AU   (天文単位)
+    get_val<double>(buf, kPosEmrat, emrat);           // EMRAT(地球と月の質量比)
+    get_ipt(buf, ipts);  // IPT  (オフセット,係数の数,サブ区間数)(水星〜月の章動,月の秤動)
+    get_val<unsigned int>(buf, kPosNumde, numde);     // NUMDE(DEバージョン番号)
+    // ヘッダ（2レコード目）
+    if (ncon > kMaxCval) { throw "[ERROR] NCON of JPLEPH is not valid!"; }
+    cvals.reserve(ncon);
+    get_dbl_list(buf, kPosCval, kReclCval, ncon, cvals);  // CVAL (定数値)
+    // 係数の配置
+    gen_layouts();
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief      取得: 定数値(CNAM 指定)
+ *
+ * @param[in]  対象 CNAM (string)
+ * @return     対象 CVAL (double)
+ *             (該当なしの場合は 0.0)
+ */
+double JplHeader::get_cval(const std::string& cnam) const {
+  unsigned int i;
+
+  for (i = 0; i < cnams.size() && i < cvals.size(); ++i) {
+    if (cnams[i] == cnam) { return cvals[i]; }
+  }
+
+  return 0.0;
+}
+
+// -------------------------------------
+// 以下、 private functions
+// -------------------------------------
+
+/*
+ * @brief       取得: (unsigned int|double) 型 1件 template
+ *
+ * @param[in]   バッファ (const char*)
+ * @param[in]   レコード位置 (unsigned int)
+ * @param[ref]  値 (class T)
+ */
+template <class T>
+void JplHeader::get_val(const char* buf, unsigned int pos, T& val) {
+  std::memcpy(&val, buf + pos, sizeof(T));
+}
+
+/*
+ * @brief       取得: vector<double> 型
+ *
+ * @param[in]   バッファ (const char*)
+ * @param[in]   レコード位置 (unsigned int)
+ * @param[in]   レコード長 (unsigned int)
+ * @param[in]   件数 (unsigned int)
+ * @param[ref]  値一覧 (vector<double>)
+ */
+void JplHeader::get_dbl_list(
+    const char* buf, unsigned int pos, unsigned int recl, unsigned int cnt,
+    std::vector<double>& vals) {
+  unsigned int i;
+  double       v;
+
+  try {
+    for (i = 0; i < cnt; ++i) {
+      std::memcpy(&v, buf + pos, recl);
+      vals.push_back(v);
+      pos += recl;
+    }
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief       取得: vector<string> 型
+ *              (後のスペースは trim)
+ *
+ * @param[in]   バッファ (const char*)
+ * @param[in]   レコード位置 (unsigned int)
+ * @param[in]   レコード長 (unsigned int)
+ * @param[in]   件数 (unsigned int)
+ * @param[ref]  値一覧 (vector<string>)
+ */
+void JplHeader::get_str_list(
+    const char* buf, unsigned int pos, unsigned int recl, unsigned int cnt,
+    std::vector<std::string>& vals) {
+  unsigned int i;
+  std::string  str;
+
+  try {
+    for (i = 0; i < cnt; ++i) {
+      str.assign(buf + pos, recl);
+      vals.push_back(str.erase(str.find_last_not_of(" ") + 1));
+      pos += recl;
+    }
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief       取得: IPT
+ *
+ * @param[in]   バッファ (const char*)
+ * @param[ref]  値一覧 (vector<vector<unsigned int>>)
+ */
+void JplHeader::get_ipt(
+    const char* buf, std::vector<std::vector<unsigned int>>& vals) {
+  unsigned int i;
+  unsigned int j;
+  unsigned int pos = kPosIpt;
+  std::vector<unsigned int> ary(3);
+
+  try {
+    // IPT13 以外
+    for (i = 0; i < kCntIpt; ++i) {
+      for (j = 0; j < 3; ++j) {
+        get_val<unsigned int>(buf, pos, ary[j]);
+        pos += kReclIpt;
+      }
+      vals.push_back(ary);
+    }
+    // IPT13
+    pos = kPosIpt2;
+    for (j = 0; j < 3; ++j) {
+      get_val<unsigned int>(buf, pos, ary[j]);
+      pos += kReclIpt;
+    }
+    vals.push_back(ary);
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief   生成: 係数の配置
+ *          * 地球の章動（IPT の12件目）のみ要素数が 2 で、その他の要素数は 3
+ *
+ * @param   <none>
+ * @return  <none>
+ */
+void JplHeader::gen_layouts() {
+  unsigned int i;
+  JplLayout    lay;
+
+  try {
+    for (i = 0; i < 13; ++i) {
+      lay.offset    = ipts[i][0] - 1;
+      lay.cnt_coeff = ipts[i][1];
+      lay.cnt_sub   = ipts[i][2];
+      lay.n_item    = 3;
+      if ((i + 1) == 12) { lay.n_item = 2; }
+      lay.eval      = cheb_func(lay.cnt_coeff);
+      lays.push_back(lay);
+    }
+  } catch (...) {
+    throw;
+  }
+}
+
+}  // namespace apparent_sun_moon
+
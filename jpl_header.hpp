@@ -0,0 +1,62 @@
+#ifndef APPARENT_SUN_MOON_JPL_HEADER_HPP_
+#define APPARENT_SUN_MOON_JPL_HEADER_HPP_
+
+#include "cheb.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace apparent_sun_moon {
+
+// 係数の配置（天体ごと; IPT より算出）
+// * 天体 i, サブ区間 s, 要素 k の係数列の先頭は
+//   offset + (s * n_item + k) * cnt_coeff
+struct JplLayout {
+  unsigned int offset;     // レコード先頭からの位置（double 単位）
+  unsigned int cnt_coeff;  // 係数の数
+  unsigned int cnt_sub;    // サブ区間数
+  unsigned int n_item;     // 要素数（地球の章動のみ 2、その他は 3）
+  ChebEval     eval;       // 評価関数（係数の数で特殊化; cheb_func）
+};
+
+// JPLEPH ヘッダ（解析済み）
+// * ヘッダ2レコード分（KSIZE * 4 * 2 byte）のバッファからメモリ上で解析する。
+// * 生成後は変更しない（const で共有して使用する）。
+class JplHeader {
+  template <class T>
+  static void get_val(const char*, unsigned int, T&);       // 取得: 値1件(template)
+  static void get_dbl_list(
+      const char*, unsigned int, unsigned int, unsigned int,
+      std::vector<double>&);                                 // 取得: vector<double> 型
+  static void get_str_list(
+      const char*, unsigned int, unsigned int, unsigned int,
+      std::vector<std::string>&);                            // 取得: vector<string> 型
+  static void get_ipt(
+      const char*, std::vector<std::vector<unsigned int>>&); // 取得: IPT
+  void gen_layouts();                                        // 生成: 係数の配置
+
+public:
+  static constexpr unsigned int kKsize = 2036;               // KSIZE
+  static constexpr std::size_t  kSize  = kKsize * 4 * 2;     // ヘッダサイズ (byte)
+
+  std::vector<std::string>               ttls;    // TTL   (84 byte *   3)
+  std::vector<std::string>               cnams;   // CNAM  ( 6 byte * 800)
+  std::vector<double>                    sss;     // SS    ( 8 byte *   3)
+  unsigned int                           ncon;    // NCON  ( 4 byte *   1)
+  double                                 au;      // AU    ( 8 byte *   1)
+  double                                 emrat;   // EMRAT ( 8 byte *   1)
+  unsigned int                           numde;   // NUMDE ( 4 byte *   1)
+  std::vector<std::vector<unsigned int>> ipts;    // IPT   ( 4 byte * 13 * 3)
+  std::vector<double>                    cvals;   // CVAL  ( 8 byte * NCON)
+  std::vector<JplLayout>                 lays;    // 係数の配置 (13天体分)
+
+  explicit JplHeader(const char*);                // コンストラクタ
+                                                  // (引数: ヘッダ2レコード分のバッファ)
+  double get_cval(const std::string&) const;      // 取得: 定数値(CNAM 指定)
+};
+
+}  // namespace apparent_sun_moon
+
+#endif
+
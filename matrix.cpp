@@ -2,6 +2,37 @@
 
 namespace apparent_sun_moon {
 
+/*
+ * @brief       回転行列（x軸中心）
+ *              * 単位行列に対する回転（行列の積は省略）
+ *
+ * @param[in]   回転量 phi(double)
+ * @param[ref]  生成後(double[3][3])
+ * @return      true|false
+ */
+bool r_x(double phi, double(&mtx)[3][3]) {
+  double s;  // sin
+  double c;  // cos
+
+  try {
+    s = sin(phi);
+    c = cos(phi);
+    mtx[0][0] = 1.0;
+    mtx[0][1] = 0.0;
+    mtx[0][2] = 0.0;
+    mtx[1][0] = 0.0;
+    mtx[1][1] =   c;
+    mtx[1][2] =   s;
+    mtx[2][0] = 0.0;
+    mtx[2][1] = - s;
+    mtx[2][2] =   c;
+  } catch (...) {
+    throw;
+  }
+
+  return true;
+}
+
 /*
  * @brief       回転行列（x軸中心）
  *
@@ -34,6 +65,37 @@ bool r_x(double phi, double(&mtx)[3][3], const double(&mtx_u)[3][3]) {
   return ret;
 }
 
+/*
+ * @brief       回転行列（y軸中心）
+ *              * 単位行列に対する回転（行列の積は省略）
+ *
+ * @param[in]   回転量 theta(double)
+ * @param[ref]  生成後(double[3][3])
+ * @return      true|false
+ */
+bool r_y(double theta, double(&mtx)[3][3]) {
+  double s;  // sin
+  double c;  // cos
+
+  try {
+    s = sin(theta);
+    c = cos(theta);
+    mtx[0][0] =   c;
+    mtx[0][1] = 0.0;
+    mtx[0][2] = - s;
+    mtx[1][0] = 0.0;
+    mtx[1][1] = 1.0;
+    mtx[1][2] = 0.0;
+    mtx[2][0] =   s;
+    mtx[2][1] = 0.0;
+    mtx[2][2] =   c;
+  } catch (...) {
+    throw;
+  }
+
+  return true;
+}
+
 /*
  * @brief       回転行列（y軸中心）
  *
@@ -66,6 +128,37 @@ bool r_y(double theta, double(&mtx)[3][3], const double(&mtx_u)[3][3]) {
   return ret;
 }
 
+/*
+ * @brief       回転行列（z軸中心）
+ *              * 単位行列に対する回転（行列の積は省略）
+ *
+ * @param[in]   回転量 psi(double)
+ * @param[ref]  生成後(double[3][3])
+ * @return      true|false
+ */
+bool r_z(double psi, double(&mtx)[3][3]) {
+  double s;  // sin
+  double c;  // cos
+
+  try {
+    s = sin(psi);
+    c = cos(psi);
+    mtx[0][0] =   c;
+    mtx[0][1] =   s;
+    mtx[0][2] = 0.0;
+    mtx[1][0] = - s;
+    mtx[1][1] =   c;
+    mtx[1][2] = 0.0;
+    mtx[2][0] = 0.0;
+    mtx[2][1] = 0.0;
+    mtx[2][2] = 1.0;
+  } catch (...) {
+    throw;
+  }
+
+  return true;
+}
+
 /*
  * @brief       回転行列（z軸中心）
  *
@@ -98,6 +191,58 @@ bool r_z(double psi, double(&mtx)[3][3], const double(&mtx_u)[3][3]) {
   return ret;
 }
 
+/*
+ * @brief       回転行列（R1(-ε) R3(-ψ) R1(φ) R3(γ) の一括生成）
+ *              * Fukushima-Williams の4角による歳差（＆章動）行列
+ *                r_z(γ), r_x(φ), r_z(-ψ), r_x(-ε) の順の適用と同一の値を、
+ *                行列の積を行わず閉じた式で生成する
+ *              * B = R3(-ψ) R1(φ) R3(γ) とすると、
+ *                  B_1j = cosψ (R3(γ))_1j - sinψ (R1(φ) R3(γ))_2j 等
+ *                  M_2j = cosε B_2j - sinε B_3j
+ *                  M_3j = sinε B_2j + cosε B_3j
+ *
+ * @param[in]   γ (double)
+ * @param[in]   φ (double)
+ * @param[in]   ψ (double)
+ * @param[in]   ε (double)
+ * @param[ref]  生成後(double[3][3])
+ * @return      true|false
+ */
+bool r_fw(double gamma, double phi, double psi, double eps,
+          double(&mtx)[3][3]) {
+  double sg = sin(gamma);
+  double cg = cos(gamma);
+  double sf = sin(phi);
+  double cf = cos(phi);
+  double sp = sin(psi);
+  double cp = cos(psi);
+  double se = sin(eps);
+  double ce = cos(eps);
+  double b[3][3];  // R3(-ψ) R1(φ) R3(γ)
+  unsigned int j;
+
+  try {
+    b[0][0] = cp * cg + sp * (cf * sg);
+    b[0][1] = cp * sg - sp * (cf * cg);
+    b[0][2] = - (sp * sf);
+    b[1][0] = sp * cg - cp * (cf * sg);
+    b[1][1] = sp * sg + cp * (cf * cg);
+    b[1][2] = cp * sf;
+    b[2][0] = sf * sg;
+    b[2][1] = - (sf * cg);
+    b[2][2] = cf;
+    for (j = 0; j < 3; ++j) {
+      mtx[0][j] = b[0][j];
+      mtx[1][j] = ce * b[1][j] - se * b[2][j];
+      mtx[2][j] = se * b[1][j] + ce * b[2][j];
+    }
+  } catch (...) {
+    throw;
+  }
+
+  return true;
+}
+
 /*
  * @brief       座標回転
  *
@@ -13,11 +13,118 @@ constexpr double kMtxUnit[3][3] = {
   {0.0, 1.0, 0.0},
   {0.0, 0.0, 1.0},
 };  // 単位行列
-bool r_x(double, double(&)[3][3], const double(&)[3][3] = kMtxUnit);  // 回転行列生成（x軸中心）
-bool r_y(double, double(&)[3][3], const double(&)[3][3] = kMtxUnit);  // 回転行列生成（y軸中心）
-bool r_z(double, double(&)[3][3], const double(&)[3][3] = kMtxUnit);  // 回転行列生成（z軸中心）
+bool r_x(double, double(&)[3][3]);                          // 回転行列生成（x軸中心）
+bool r_x(double, double(&)[3][3], const double(&)[3][3]);   // 回転行列生成（x軸中心; 既存行列に適用）
+bool r_y(double, double(&)[3][3]);                          // 回転行列生成（y軸中心）
+bool r_y(double, double(&)[3][3], const double(&)[3][3]);   // 回転行列生成（y軸中心; 既存行列に適用）
+bool r_z(double, double(&)[3][3]);                          // 回転行列生成（z軸中心）
+bool r_z(double, double(&)[3][3], const double(&)[3][3]);   // 回転行列生成（z軸中心; 既存行列に適用）
+bool r_fw(double, double, double, double, double(&)[3][3]);
+                                       // 回転行列生成（R1(-ε) R3(-ψ) R1(φ) R3(γ) の一括生成）
 Coord rotate(Coord, double(&)[3][3]);  // 座標回転
 
+// -------------------------------------
+// コンパイル時評価用（constexpr）
+// * 定数の回転（フレームバイアス等）をコンパイル時に行列化する
+// * sin/cos は Taylor 展開（|θ| <= π/4 で倍精度の丸め誤差程度）
+// -------------------------------------
+struct Mtx3 {
+  double m[3][3];
+};
+
+constexpr Mtx3 kMtx3Unit = {{
+  {1.0, 0.0, 0.0},
+  {0.0, 1.0, 0.0},
+  {0.0, 0.0, 1.0},
+}};  // 単位行列
+
+/*
+ * @brief      sin（コンパイル時評価用; |θ| <= π/4）
+ *
+ * @param[in]  角度 (double; rad)
+ * @return     sin(θ) (double)
+ */
+constexpr double sin_c(double x) {
+  double x2 = x * x;
+  double t  = 1.0;
+
+  for (int k = 25; k > 1; k -= 2) { t = 1.0 - x2 / (k * (k - 1)) * t; }
+
+  return x * t;
+}
+
+/*
+ * @brief      cos（コンパイル時評価用; |θ| <= π/4）
+ *
+ * @param[in]  角度 (double; rad)
+ * @return     cos(θ) (double)
+ */
+constexpr double cos_c(double x) {
+  double x2 = x * x;
+  double t  = 1.0;
+
+  for (int k = 24; k > 0; k -= 2) { t = 1.0 - x2 / (k * (k - 1)) * t; }
+
+  return t;
+}
+
+/*
+ * @brief      回転行列（x軸中心; コンパイル時評価用）
+ *             * 計算式は r_x と同一
+ *
+ * @param[in]  回転量 phi(double)
+ * @param[in]  生成前(Mtx3; optional)
+ * @return     生成後(Mtx3)
+ */
+constexpr Mtx3 r_x_c(double phi, const Mtx3& u = kMtx3Unit) {
+  double s = sin_c(phi);
+  double c = cos_c(phi);
+
+  return {{
+    {         u.m[0][0],               u.m[0][1],               u.m[0][2]},
+    { c * u.m[1][0] + s * u.m[2][0],  c * u.m[1][1] + s * u.m[2][1],  c * u.m[1][2] + s * u.m[2][2]},
+    {-s * u.m[1][0] + c * u.m[2][0], -s * u.m[1][1] + c * u.m[2][1], -s * u.m[1][2] + c * u.m[2][2]},
+  }};
+}
+
+/*
+ * @brief      回転行列（y軸中心; コンパイル時評価用）
+ *             * 計算式は r_y と同一
+ *
+ * @param[in]  回転量 theta(double)
+ * @param[in]  生成前(Mtx3; optional)
+ * @return     生成後(Mtx3)
+ */
+constexpr Mtx3 r_y_c(double theta, const Mtx3& u = kMtx3Unit) {
+  double s = sin_c(theta);
+  double c = cos_c(theta);
+
+  return {{
+    {c * u.m[0][0] - s * u.m[2][0], c * u.m[0][1] - s * u.m[2][1], c * u.m[0][2] - s * u.m[2][2]},
+    {        u.m[1][0],                     u.m[1][1],                     u.m[1][2]},
+    {s * u.m[0][0] + c * u.m[2][0], s * u.m[0][1] + c * u.m[2][1], s * u.m[0][2] + c * u.m[2][2]},
+  }};
+}
+
+/*
+ * @brief      回転行列（z軸中心; コンパイル時評価用）
+ *             * 計算式は r_z と同一
+ *
+ * @param[in]  回転量 psi(double)
+ * @param[in]  生成前(Mtx3; optional)
+ * @return     生成後(Mtx3)
+ */
+constexpr Mtx3 r_z_c(double psi, const Mtx3& u = kMtx3Unit) {
+  double s = sin_c(psi);
+  double c = cos_c(psi);
+
+  return {{
+    { c * u.m[0][0] + s * u.m[1][0],  c * u.m[0][1] + s * u.m[1][1],  c * u.m[0][2] + s * u.m[1][2]},
+    {-s * u.m[0][0] + c * u.m[1][0], -s * u.m[0][1] + c * u.m[1][1], -s * u.m[0][2] + c * u.m[1][2]},
+    {         u.m[2][0],                      u.m[2][1],                      u.m[2][2]},
+  }};
+}
+
 }  // namespace apparent_sun_moon
 
 #endif
@@ -0,0 +1,197 @@
+/***********************************************************
+  章動計算の検証（精度・速度）
+
+  * 章動の計算方法（評価方法）を切り替えて同一時刻で計算し、
+    基準との差の最大値と1回あたりの計算時間を出力する
+  * 比較は Nutation::calc_nutation の値（Bpn::comp_nut の
+    IAU 2006 補正前）で行う
+  * JPLEPH, NUT_LS.txt, NUT_PL.txt は実行ディレクトリに配置すること
+----------------------------------------------------------
+  引数 : 検証内容 [開始 JD [終了 JD [件数]]]
+           検証内容: jpl   ... JPL 暦の章動（NutSrc::kJpl）と
+                               IAU 2000A 級数（NutSrc::kSeries）の比較
+                               （JPLEPH に章動が含まれる場合のみ）
+                     recur ... 級数の評価方法 漸化式（NutEval::kRecur）と
+                               直接計算（NutEval::kDirect）の比較
+                     simd  ... 直接計算の SIMD（AVX2）実装（NutEval::kDirect）と
+                               スカラー実装（NutEval::kScalar）の比較
+                               （AVX2 が使用できない場合は両者とも
+                                 スカラー実装）
+           開始 JD, 終了 JD: TT（既定: 2451545.0 〜 2469807.5;
+                             jpl の場合は JPLEPH の収録期間）
+           件数: 既定 2000
+***********************************************************/
+#include "jpl_eph.hpp"
+#include "nutation.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>   // for EXIT_XXXX
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ns = apparent_sun_moon;
+
+// 定数
+static constexpr double kJ2000 = 2451545.0;  // Reference epoch (J2000.0)
+static constexpr double kJc    = 36525.0;    // Days per Julian century
+static constexpr double kPi    = atan(1.0) * 4;  // 円周率
+static constexpr double kR2Uas = 180.0 / kPi * 3600.0 * 1.0e6;
+                                             // rad -> μas
+
+/*
+ * @brief       計算: 全時刻の章動と1回あたりの計算時間
+ *              * 計算は現在の設定（set_src, set_eval）で行う
+ *
+ * @param[in]   T 一覧 (vector<double>)
+ * @param[ref]  delta-psi 一覧 (vector<double>; rad)
+ * @param[ref]  delta-eps 一覧 (vector<double>; rad)
+ * @return      1回あたりの計算時間 (double; μs)
+ */
+static double calc_all(const std::vector<double>& ts,
+                       std::vector<double>& dpsis, std::vector<double>& depss) {
+  std::size_t i;
+
+  dpsis.resize(ts.size());
+  depss.resize(ts.size());
+  auto t_0 = std::chrono::steady_clock::now();
+  for (i = 0; i < ts.size(); ++i) {
+    ns::Nutation o_n(ts[i]);
+    if (!o_n.calc_nutation(dpsis[i], depss[i])) {
+      throw "[ERROR] Could not calculate delta-psi, delta-epsilon!";
+    }
+  }
+  auto t_1 = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::micro>(t_1 - t_0).count()
+       / ts.size();
+}
+
+/*
+ * @brief       出力: 基準との差の最大値と計算時間
+ *
+ * @param[in]   名称: 基準 (string)
+ * @param[in]   名称: 比較対象 (string)
+ * @param[in]   計算時間: 基準 (double; μs)
+ * @param[in]   計算時間: 比較対象 (double; μs)
+ * @param[in]   delta-psi 一覧: 基準 (vector<double>)
+ * @param[in]   delta-eps 一覧: 基準 (vector<double>)
+ * @param[in]   delta-psi 一覧: 比較対象 (vector<double>)
+ * @param[in]   delta-eps 一覧: 比較対象 (vector<double>)
+ * @return      <none>
+ */
+static void print_diff(
+    const std::string& nm_0, const std::string& nm_1, double tm_0, double tm_1,
+    const std::vector<double>& dpsis_0, const std::vector<double>& depss_0,
+    const std::vector<double>& dpsis_1, const std::vector<double>& depss_1) {
+  double      d_psi = 0.0;  // max |Δψ| (rad)
+  double      d_eps = 0.0;  // max |Δε| (rad)
+  std::size_t i;
+
+  for (i = 0; i < dpsis_0.size(); ++i) {
+    d_psi = std::fmax(d_psi, std::fabs(dpsis_1[i] - dpsis_0[i]));
+    d_eps = std::fmax(d_eps, std::fabs(depss_1[i] - depss_0[i]));
+  }
+  std::cout << std::fixed << std::setprecision(3)
+            << "  " << std::setw(8) << std::left << nm_0 << std::right
+            << std::setw(12) << tm_0 << " us/call" << std::endl
+            << "  " << std::setw(8) << std::left << nm_1 << std::right
+            << std::setw(12) << tm_1 << " us/call" << std::endl
+            << std::scientific << std::setprecision(3)
+            << "  max |d-psi| = " << d_psi * kR2Uas << " uas" << std::endl
+            << "  max |d-eps| = " << d_eps * kR2Uas << " uas" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  std::string         mode;         // 検証内容
+  double              jd_s = 2451545.0;  // 開始 JD
+  double              jd_e = 2469807.5;  // 終了 JD
+  unsigned int        n    = 2000;       // 件数
+  std::vector<double> ts;           // T 一覧
+  std::vector<double> dpsis_0;      // delta-psi 一覧: 基準
+  std::vector<double> depss_0;      // delta-eps 一覧: 基準
+  std::vector<double> dpsis_1;      // delta-psi 一覧: 比較対象
+  std::vector<double> depss_1;      // delta-eps 一覧: 比較対象
+  double              tm_0;         // 計算時間: 基準
+  double              tm_1;         // 計算時間: 比較対象
+  unsigned int        i;
+
+  try {
+    if (argc < 2) {
+      std::cout << "Usage: " << argv[0]
+                << " jpl|recur|simd [JD_START [JD_END [COUNT]]]" << std::endl;
+      return EXIT_FAILURE;
+    }
+    mode = argv[1];
+    if (mode == "jpl") {
+      jd_s = ns::JplEph::get().hdr.sss[0];
+      jd_e = ns::JplEph::get().hdr.sss[1] - 1.0;
+    }
+    if (argc > 2) { jd_s = std::stod(argv[2]); }
+    if (argc > 3) { jd_e = std::stod(argv[3]); }
+    if (argc > 4) { n    = std::stoul(argv[4]); }
+    if (n < 2 || !(jd_e > jd_s)) {
+      std::cout << "[ERROR] Invalid range!" << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (mode == "jpl" && (jd_s < ns::JplEph::get().hdr.sss[0]
+                          || jd_e >= ns::JplEph::get().hdr.sss[1])) {
+      std::cout << "[ERROR] JD is out of range of JPLEPH!" << std::endl;
+      return EXIT_FAILURE;
+    }
+    for (i = 0; i < n; ++i) {
+      ts.push_back((jd_s + (jd_e - jd_s) * i / (n - 1) - kJ2000) / kJc);
+    }
+    std::cout << "JD " << std::fixed << std::setprecision(1) << jd_s
+              << " - " << jd_e << " (TT), " << n << " epochs" << std::endl;
+
+    if (mode == "jpl") {
+      // JPL 暦の章動 vs IAU 2000A 級数
+      ns::Nutation::set_src(ns::NutSrc::kJpl);
+      if (!ns::Nutation::is_jpl()) {
+        std::cout << "[ERROR] JPLEPH has no nutations!" << std::endl;
+        return EXIT_FAILURE;
+      }
+      std::cout << "JPLEPH DE" << ns::JplEph::get().hdr.numde
+                << ": nutation (JPL) vs IAU 2000A series" << std::endl;
+      tm_1 = calc_all(ts, dpsis_1, depss_1);
+      ns::Nutation::set_src(ns::NutSrc::kSeries);
+      tm_0 = calc_all(ts, dpsis_0, depss_0);
+      print_diff("series", "jpl", tm_0, tm_1,
+                 dpsis_0, depss_0, dpsis_1, depss_1);
+    } else if (mode == "recur") {
+      // 級数の評価方法: 漸化式 vs 直接計算
+      ns::Nutation::set_src(ns::NutSrc::kSeries);
+      std::cout << "IAU 2000A series: recurrence vs direct" << std::endl;
+      ns::Nutation::set_eval(ns::NutEval::kDirect);
+      tm_0 = calc_all(ts, dpsis_0, depss_0);
+      ns::Nutation::set_eval(ns::NutEval::kRecur);
+      tm_1 = calc_all(ts, dpsis_1, depss_1);
+      print_diff("direct", "recur", tm_0, tm_1,
+                 dpsis_0, depss_0, dpsis_1, depss_1);
+    } else if (mode == "simd") {
+      // 直接計算: SIMD（AVX2）vs スカラー
+      ns::Nutation::set_src(ns::NutSrc::kSeries);
+      std::cout << "IAU 2000A series: SIMD (AVX2) vs scalar" << std::endl;
+      ns::Nutation::set_eval(ns::NutEval::kScalar);
+      tm_0 = calc_all(ts, dpsis_0, depss_0);
+      ns::Nutation::set_eval(ns::NutEval::kDirect);
+      tm_1 = calc_all(ts, dpsis_1, depss_1);
+      print_diff("scalar", "simd", tm_0, tm_1,
+                 dpsis_0, depss_0, dpsis_1, depss_1);
+    } else {
+      std::cout << "[ERROR] Invalid mode: " << mode << std::endl;
+      return EXIT_FAILURE;
+    }
+  } catch (const char* e) {
+    std::cout << e << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cout << "[ERROR] Unknown exception!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
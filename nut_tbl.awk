@@ -0,0 +1,67 @@
+# 章動の級数（NUT_LS.txt, NUT_PL.txt）から SoA の constexpr テーブル（nut_tbl.hpp）を生成
+#
+# * 使用方法: awk -f nut_tbl.awk NUT_LS.txt NUT_PL.txt > nut_tbl.hpp
+#   （Makefile から実行される）
+# * 列ごとに1配列（[列][項]）とし、引数の係数は int、振幅は double で出力する
+# * 振幅は File::get_param_(ls|pl) と同様に 10000 倍する
+#   （字句はそのまま出力し、倍率は式として付加するため、丸めは実行時の読み込みと一致）
+# * 数値で始まらない行（見出し行等）は無視する
+
+FNR == 1 { ++f }
+
+$1 ~ /^[-+]?[0-9.]/ {
+  if (nc[f] != "" && nc[f] != NF) {
+    printf "[ERROR] Invalid column count: %s (line %d)\n", FILENAME, FNR > "/dev/stderr"
+    err = 1
+    exit 1
+  }
+  nc[f] = NF
+  ++n[f]
+  for (c = 1; c <= NF; ++c) { v[f, c, n[f]] = $c }
+}
+
+# 1列分の配列要素を出力
+function emit_col(k, c, sfx,   i) {
+  printf "  {"
+  for (i = 1; i <= n[k]; ++i) {
+    if (i > 1) { printf "," }
+    if ((i - 1) % 8 == 0) { printf "\n    " } else { printf " " }
+    printf "%s%s", v[k, c, i], sfx
+  }
+  printf "\n  },\n"
+}
+
+# 1ファイル分（引数の係数、振幅）のテーブルを出力
+function emit(k, name, n_mul,   c) {
+  printf "// %s\n", name == "Ls" ? "lunisolar" : "planetary"
+  printf "constexpr unsigned int kNut%sN   = %d;  // 項数\n", name, n[k]
+  printf "constexpr unsigned int kNut%sMul = %d;  // 引数の係数の列数\n", name, n_mul
+  printf "constexpr unsigned int kNut%sAmp = %d;  // 振幅の列数\n", name, nc[k] - n_mul
+  printf "constexpr int kNut%sMulTbl[kNut%sMul][kNut%sN] = {\n", name, name, name
+  for (c = 1; c <= n_mul; ++c) { emit_col(k, c, "") }
+  printf "};\n"
+  printf "constexpr double kNut%sAmpTbl[kNut%sAmp][kNut%sN] = {\n", name, name, name
+  for (c = n_mul + 1; c <= nc[k]; ++c) { emit_col(k, c, " * 10000") }
+  printf "};\n\n"
+}
+
+END {
+  if (err) { exit 1 }
+  if (f != 2 || nc[1] != 11 || nc[2] != 18) {
+    print "[ERROR] Invalid nutation parameter files!" > "/dev/stderr"
+    exit 1
+  }
+  print "// 自動生成ファイル（nut_tbl.awk により NUT_LS.txt, NUT_PL.txt から生成）"
+  print "// 直接編集しないこと"
+  print "#ifndef APPARENT_SUN_MOON_NUT_TBL_HPP_"
+  print "#define APPARENT_SUN_MOON_NUT_TBL_HPP_"
+  print ""
+  print "namespace apparent_sun_moon {"
+  print ""
+  emit(1, "Ls", 5)
+  emit(2, "Pl", 14)
+  print "}  // namespace apparent_sun_moon"
+  print ""
+  print "#endif"
+}
+
@@ -0,0 +1,2569 @@
+// 自動生成ファイル（nut_tbl.awk により NUT_LS.txt, NUT_PL.txt から生成）
+// 直接編集しないこと
+#ifndef APPARENT_SUN_MOON_NUT_TBL_HPP_
+#define APPARENT_SUN_MOON_NUT_TBL_HPP_
+
+namespace apparent_sun_moon {
+
+// lunisolar
+constexpr unsigned int kNutLsN   = 678;  // 項数
+constexpr unsigned int kNutLsMul = 5;  // 引数の係数の列数
+constexpr unsigned int kNutLsAmp = 6;  // 振幅の列数
+constexpr int kNutLsMulTbl[kNutLsMul][kNutLsN] = {
+  {
+    0, 0, 0, 0, 0, 0, 1, 0,
+    1, 0, 0, -1, -1, 1, -1, -1,
+    1, -2, 0, 0, 0, -2, 2, 1,
+    -1, 2, 0, 0, -1, 0, 0, 1,
+    0, -1, 0, 1, -2, 0, 0, 0,
+    0, 1, 2, -2, 2, 0, 0, -1,
+    2, 1, 0, 1, -2, 3, 0, 1,
+    0, -1, -1, 0, -2, 1, 2, -1,
+    1, 1, -1, 1, -1, 0, -1, -1,
+    0, 1, -2, -1, 1, -2, -1, 2,
+    2, 1, 3, 3, 0, 0, 0, 0,
+    -1, 2, -2, -1, -1, 0, 0, 0,
+    0, 0, -2, 1, -1, -1, 1, 1,
+    -1, 3, 0, -1, 0, -1, 0, 1,
+    -1, 0, 2, 0, 1, -1, 0, 0,
+    0, 0, -1, 2, 1, 1, 2, 1,
+    -1, 0, 0, -1, 0, -1, 1, 1,
+    0, 1, 0, 1, -1, 1, 1, 0,
+    -1, -2, 4, 2, 2, 0, 1, -1,
+    0, -2, 2, 1, -1, -1, 2, 0,
+    -1, 2, 0, 0, 0, 0, 0, 0,
+    -1, 1, -2, -2, -2, -1, 0, 3,
+    -2, 1, 0, -2, -3, 1, 0, 3,
+    -1, 2, 0, 2, -1, 0, 0, 2,
+    4, 2, 0, 1, 0, -3, -1, -1,
+    -1, -2, 1, -2, -2, 2, -3, -2,
+    -1, 0, -1, 0, -1, 2, 0, -2,
+    -1, -1, 3, -1, 2, 0, 0, 2,
+    0, -1, 0, 1, 1, -1, 1, -2,
+    -1, -2, 0, 1, 2, 1, 4, 2,
+    3, -2, 1, 1, -1, 0, 0, -2,
+    -2, -1, 1, 0, -1, 1, 1, 2,
+    1, 2, -2, 1, 0, 1, -2, 1,
+    1, 1, 2, 3, 4, -2, 0, 1,
+    0, 2, -1, 1, 0, 0, -1, 0,
+    -2, -1, 2, 0, 0, -1, -2, 1,
+    -3, -3, -2, 2, -2, 1, 0, -1,
+    0, 1, 1, -1, 3, 0, 2, 0,
+    2, -1, 1, 1, 0, -1, 3, -1,
+    1, -2, 2, -1, 1, 2, 1, -3,
+    2, -1, -4, -1, 0, 1, 0, -2,
+    0, -2, -2, 0, 1, 3, -1, 1,
+    1, -3, -3, -2, 0, -3, -1, 0,
+    2, 0, 1, -2, -2, -4, 1, -1,
+    0, 0, -3, -3, 1, -1, 1, 1,
+    0, -1, 1, 0, -1, 1, -1, 1,
+    -1, -1, 3, 1, 1, -2, 0, -2,
+    -2, 2, 1, 0, 1, -2, 2, 0,
+    0, 0, 0, -3, -1, 1, -1, -1,
+    -1, 1, 0, -2, 0, 0, -1, -1,
+    -2, 1, 0, 3, 2, 1, 0, 1,
+    3, 3, 2, 1, 0, 1, -2, 0,
+    -2, 0, 0, -1, -2, 2, 2, -1,
+    3, 4, -1, -1, -3, -1, 3, 3,
+    3, 1, 5, 0, 2, 0, 1, 3,
+    3, 5, 0, 4, 0, -1, 0, 1,
+    2, -1, -1, -1, -2, -1, -4, -3,
+    -2, 1, 2, -4, -3, -1, 0, 0,
+    -3, -2, -1, -4, 2, 2, 0, -1,
+    -2, 1, 1, 0, 1, -1, -2, -2,
+    -2, -2, 1, 1, -1, 2, -1, 0,
+    -1, -1, 0, -2, 1, 1, -3, -1,
+    -1, -3, -3, 2, 0, 2, -2, 0,
+    0, -1, 2, -4, -1, 0, -3, -1,
+    -2, 0, -2, 1, -1, 1, 2, 2,
+    0, 0, -1, -1, -1, -2, 0, -2,
+    0, -3, 1, -1, 1, 0, 0, 0,
+    -1, 0, -2, 2, 3, 1, 1, 2,
+    -1, -2, 0, 0, -1, -2, -1, 2,
+    1, -1, 0, -1, -1, -1, 0, -2,
+    2, 1, 1, 1, 0, 2, 0, 0,
+    0, 4, 2, 2, -1, -1, -3, -3,
+    -1, -3, -3, 0, -2, -4, -1, -3,
+    0, -1, 1, 0, -1, 0, -2, -1,
+    3, 2, 2, 0, 0, 0, -1, -1,
+    1, 3, 1, -2, 0, -2, -2, 0,
+    0, -1, -2, 2, 1, 0, 0, 1,
+    0, 1, -1, -2, 2, 2, 2, 1,
+    0, 2, 3, 1, 1, 1, 0, 2,
+    2, 4, -1, -3, -1, -3, 1, 1,
+    -2, 1, 3, 1, 0, -1, 0, -1,
+    2, 5, 2, 1, 3, 3, -2, 0,
+    0, -2, 2, 2, 2, 0, 1, 4,
+    2, 0, 4, 3, 2, 4, -1, -1,
+    1, 1, 3, 5, 2, 2
+  },
+  {
+    0, 0, 0, 0, 1, 1, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 1, 0, 2, 0, 0,
+    -1, 0, 2, 0, 0, 1, 0, -1,
+    0, 0, 0, 0, 0, -1, 0, -1,
+    0, 0, 1, -1, 0, 0, -1, -1,
+    0, -1, 0, -1, 0, 1, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 1,
+    -2, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, -1, 0, 1, 0, -1,
+    0, 0, -1, 1, 1, 1, -1, -1,
+    1, 0, 1, 0, 1, -1, -1, 0,
+    0, -1, -1, 0, -1, 1, 1, -1,
+    3, 0, 0, 1, 1, 1, 0, 0,
+    0, 1, 1, 0, 0, 1, 0, -1,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, -1, 1, 1, 0, -1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    -2, 1, 0, 0, 3, 0, -1, 0,
+    -1, 0, 2, -1, 0, -1, 0, 0,
+    -1, 0, -2, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 1, 0, -2, 0,
+    0, 0, 2, 0, 2, 0, 1, -1,
+    -2, -1, -1, 1, 1, 1, 0, 0,
+    1, -1, 0, -2, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 1, -1, -1,
+    2, -1, -2, 0, -1, -1, -1, -1,
+    0, -1, 2, 1, 0, 0, 0, 1,
+    -1, 2, 0, 1, -1, -1, -1, 0,
+    0, 0, -2, 1, 2, -1, 2, -1,
+    0, 1, 0, -2, 1, 0, 0, 1,
+    0, 0, 0, 1, 0, -1, 1, 0,
+    -1, -1, 0, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, -1, 1, 1, 1, 1,
+    0, -1, 1, 2, 1, -1, -1, 0,
+    0, -1, 0, -2, 0, 1, 0, 0,
+    1, 0, 1, 0, 0, 0, 1, 1,
+    0, 0, 0, -1, 0, 0, -1, 1,
+    0, -2, 0, -2, 2, 0, 1, -1,
+    1, 0, 0, 0, 0, 0, -1, 1,
+    1, 2, 0, 0, -1, 0, 1, 0,
+    0, 3, -1, 0, -1, -1, -2, -1,
+    0, -1, -2, -1, 0, 1, 1, 2,
+    2, 0, 0, 2, 0, -1, -1, 1,
+    -1, 0, 0, 1, -1, 0, 1, 1,
+    -1, 0, 2, 0, -1, -2, 0, -2,
+    0, 0, 0, 0, 0, 0, 1, -1,
+    0, 0, -1, -1, 0, -1, 0, 0,
+    1, -1, 0, 1, 0, 2, 0, -1,
+    -1, -2, -1, 0, 1, 0, -2, 1,
+    0, 0, 0, -2, 0, 0, 0, -1,
+    0, 0, 0, -1, -1, 1, -1, -1,
+    0, 0, 0, 0, -1, 0, -2, 0,
+    -2, 0, 0, -1, 2, 0, 1, 0,
+    -1, 0, -1, 0, 1, 0, -2, -2,
+    0, -1, 0, 0, 1, -1, 0, 2,
+    1, 1, 0, 2, -1, 1, 0, 0,
+    -2, 0, 2, 1, 2, 0, 2, 0,
+    -1, 1, 0, 1, -2, 0, 1, 1,
+    -1, 0, -1, 0, 1, 0, 1, -1,
+    1, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 1,
+    1, 1, -1, -3, 0, -1, 0, 0,
+    -1, 0, 1, 1, -2, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 2, 0,
+    1, -2, -3, 0, -1, 0, 0, -2,
+    -1, 0, -2, 0, 1, -1, -1, 1,
+    -2, 1, 0, 0, 2, -1, -1, 0,
+    1, 0, 2, 0, -2, -3, 0, 0,
+    -1, 0, 0, 1, 1, 0, 0, 0,
+    0, 1, -2, 1, 0, 0, 0, 1,
+    0, 1, -1, 0, 0, 0, 2, 0,
+    2, 1, 1, -1, -2, 0, -2, -3,
+    0, -1, 0, -1, 0, 1, 1, -1,
+    0, 0, 0, 0, 1, 1, -1, 0,
+    1, 0, 0, 0, 0, 1, 2, 1,
+    0, 1, -1, -1, 0, 0, -1, -1,
+    0, -2, -1, -1, 0, 1, 1, 0,
+    0, 0, 1, 0, 1, 0, -1, 0,
+    -2, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, -1, 0, 1, 1, -1, 0,
+    -1, 1, 1, 0, -1, 0
+  },
+  {
+    0, 2, 2, 0, 0, 2, 0, 2,
+    2, 2, 2, 2, 0, 0, 0, 2,
+    2, 2, 0, 2, 2, 0, 2, 2,
+    2, 0, 2, 0, 0, 2, -2, 0,
+    0, 2, 0, 2, 2, 2, 2, 2,
+    0, 2, 2, 0, 2, 2, 0, 0,
+    0, 0, 2, 0, 2, 2, 0, 2,
+    0, 2, 2, 2, 0, 2, 0, 0,
+    0, 2, 2, 0, 0, 2, 2, 0,
+    2, 2, 2, 0, 2, 2, 4, 2,
+    2, 0, 0, 2, 4, 2, -2, 2,
+    0, -2, 0, 0, 0, 0, -2, 2,
+    2, 2, 0, 0, 0, 0, 0, 2,
+    2, 2, -2, 0, 2, 2, 0, 2,
+    -2, 2, 2, 0, 2, 2, 0, -2,
+    2, 0, 2, 2, 0, 2, 0, -2,
+    0, 0, 0, 2, 0, 0, 2, 0,
+    0, 2, 2, 0, 2, -2, 2, 2,
+    2, 2, 2, 0, 2, 2, 4, 0,
+    0, 2, 2, 0, 0, 4, 2, 2,
+    0, 0, 4, 0, 0, 2, 0, 0,
+    2, 2, 0, 2, 0, 2, 4, 2,
+    0, 0, 0, 0, 0, 2, 2, 2,
+    2, 0, 0, 2, 0, 2, 2, 0,
+    2, 0, 0, 0, 2, 0, 2, 0,
+    2, 2, 2, 0, 2, 0, 2, 2,
+    0, 2, 4, 2, 2, 0, 2, 4,
+    -2, 2, 0, 2, 2, 2, 2, 2,
+    -2, 2, 0, 2, 0, 2, 2, 0,
+    0, 2, 2, 0, 2, 2, 0, 2,
+    2, 0, 2, 2, 2, 0, 0, 0,
+    -2, -2, 0, 0, 0, 2, 2, 2,
+    2, 2, 0, 2, 2, 4, 4, 2,
+    0, 2, 2, 2, 2, 2, -2, -2,
+    -2, 0, 2, 2, 2, 2, -2, 2,
+    0, 0, 2, 4, 4, 0, 0, -2,
+    2, 2, 2, 0, 2, 0, 4, 0,
+    0, 0, 0, 2, 2, 0, 0, 4,
+    4, 2, 0, 2, 2, 2, 0, 4,
+    2, 2, 2, 2, 2, 2, -2, 2,
+    -2, 0, 2, 0, -2, 0, 2, 2,
+    2, 0, -2, -2, 0, 0, 2, 2,
+    0, 2, 2, 0, -2, 0, -2, 2,
+    0, 0, 0, 2, 0, 0, 0, 2,
+    4, 2, 0, 0, -2, 0, 0, 0,
+    0, 2, 2, 2, 2, 0, 2, 0,
+    2, 4, 2, 2, 4, 0, 0, 0,
+    2, -2, 0, 0, 2, 4, 0, 2,
+    4, 4, 2, 0, 0, 0, 0, 2,
+    0, -2, -2, -2, 0, 0, 0, 2,
+    2, 0, 2, 0, 0, 2, 2, 2,
+    0, 2, 2, 2, 4, 2, 0, 0,
+    2, 2, 2, 2, 2, 0, 2, 2,
+    2, 2, 0, 2, 2, 2, 0, 2,
+    2, 4, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 1, 1, 2, -1,
+    0, 1, 1, 2, 0, 1, 2, 2,
+    2, -2, -2, 2, 0, -1, 0, 0,
+    0, 0, -2, 0, -2, 0, 1, 0,
+    2, 0, 1, 0, 2, 2, 4, 4,
+    0, -2, 2, 2, 2, 0, 0, 0,
+    2, 0, 0, 0, 0, -2, 0, -2,
+    0, 0, 0, 2, 2, 0, 2, 2,
+    0, 0, -2, 2, 0, -2, 0, -2,
+    -2, -4, -2, 2, 2, 0, 2, 2,
+    4, 4, -2, 0, -2, 0, -2, 0,
+    0, 2, -2, 0, 2, 1, 1, 1,
+    0, 2, 2, 0, 0, 2, 0, 2,
+    4, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 2, 1, 0, 2, 2, 2,
+    2, 0, 1, 1, 0, 2, 4, 4,
+    4, 2, 2, 4, 0, 2, 2, 2,
+    0, 0, -2, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 2, 2, 2, 2,
+    0, 0, 2, 2, 3, 3, 2, 4,
+    2, 2, 4, 0, 0, 0, 2, 2,
+    0, 2, 2, 0, 0, 0, 0, 2,
+    2, 2, 2, 4, 0, 0, 2, 2,
+    2, 2, 2, 2, 3, 2, 2, 2,
+    4, 2, 0, 2, 0, 2, 0, 0,
+    2, 2, 0, 2, 2, 2, 2, 4,
+    2, 0, 2, 4, 2, 4, 2, 0,
+    2, 2, 0, 0, 2, 2, 2, 0,
+    2, 4, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2
+  },
+  {
+    0, -2, 0, 0, 0, -2, 0, 0,
+    0, -2, -2, 0, 2, 0, 0, 2,
+    0, 0, 2, 2, -2, 2, 0, -2,
+    0, 0, 0, 0, 2, -2, 2, -2,
+    0, 2, 0, 2, 0, 0, 2, 0,
+    2, -2, -2, 2, 0, -2, -2, 2,
+    -2, 2, -2, 0, 0, 0, 2, 0,
+    1, 2, 0, 2, 0, 0, 0, 1,
+    0, 0, -2, 0, 1, 1, 4, 1,
+    -2, 2, 2, 0, -2, 4, 0, -2,
+    2, 2, 0, -2, -2, 0, 2, -2,
+    4, 0, 4, 2, 1, 0, 0, 0,
+    -1, 4, 2, -2, 2, 1, 0, 2,
+    2, 0, 2, -2, 2, 2, 0, -4,
+    2, 2, 0, 2, 0, 0, 2, 2,
+    -2, 1, 2, 0, 0, 0, 2, 2,
+    2, 1, -2, -2, -1, 0, -1, 2,
+    4, 1, 1, -2, 4, 0, -2, 2,
+    -1, 2, 0, 0, -2, 1, -2, 0,
+    2, 4, 0, 1, 4, 0, 2, -3,
+    2, 0, 0, 0, 0, -4, 2, 4,
+    4, 4, 2, 0, 2, 0, -2, -2,
+    2, -1, 2, 4, 0, 2, 4, 2,
+    -2, -4, -2, -4, 2, -1, 2, 2,
+    -2, -2, 0, -4, -2, 4, 0, 4,
+    2, 4, 2, 2, 0, -2, 0, -2,
+    2, -1, -2, 0, 1, 0, 0, 0,
+    0, 2, 0, 3, 0, 2, 4, 2,
+    2, -1, 0, -4, -2, 0, -2, 4,
+    3, 2, 0, 2, -1, 1, 0, 0,
+    0, 2, -3, -4, -2, -1, -2, 0,
+    2, 4, 0, 1, 2, -2, -2, -2,
+    -1, -2, -2, 0, 1, -2, 2, 1,
+    4, 2, 1, 0, 0, 0, 2, 1,
+    2, -2, -1, -3, -2, -3, 2, -4,
+    0, -1, -4, -4, -4, 2, 3, 2,
+    2, 2, 2, 0, 2, 1, -2, -2,
+    -4, 2, 2, 2, -2, 4, 2, 0,
+    -2, 4, 4, 2, 3, 4, 2, 2,
+    2, 6, 2, 6, 4, 4, 1, 1,
+    0, 1, 2, 1, 2, -1, -2, 0,
+    -2, 2, 4, 2, -2, -4, -2, -4,
+    -2, 0, 0, 1, 1, 2, 2, -4,
+    -4, -2, -3, -2, 0, 2, -4, -4,
+    -4, -2, 4, 4, 2, 2, 0, 0,
+    1, 0, -2, -1, 0, 0, 0, 0,
+    0, -2, -4, -2, -4, 4, 2, 4,
+    2, 2, 1, 2, -1, 0, 0, 0,
+    -2, -2, 0, 6, 4, 2, 4, 2,
+    -2, -2, -2, 0, 3, 3, 4, 2,
+    3, 2, 1, 0, 1, 0, 1, 0,
+    0, -2, -1, 0, -1, 0, 6, 4,
+    4, 2, 2, 3, 4, 2, 0, 3,
+    -1, -2, 6, 4, 6, 4, 2, 0,
+    0, 0, -2, 4, 2, 4, 4, 2,
+    2, 0, 6, 2, -1, 0, -2, 0,
+    -2, 0, 0, -1, 2, 0, 2, 1,
+    0, 1, 0, 2, 3, 2, 0, 0,
+    3, 2, 3, 4, 0, -2, -1, 1,
+    0, -1, -2, 0, -3, -1, -2, -2,
+    2, 4, -4, -4, -2, -3, 0, -2,
+    -2, 0, -1, 1, -2, 0, 2, 2,
+    0, 2, 2, -6, -4, -4, -2, -4,
+    -2, -2, -2, 0, -1, 0, 1, 1,
+    2, 2, 2, -6, -4, -4, -4, -4,
+    -4, -4, 4, 2, 4, 3, 3, 3,
+    1, 2, 2, 2, -2, 0, 0, 0,
+    2, 0, 0, -1, -2, -2, 0, -3,
+    -2, 4, 2, 4, 3, 4, 3, 0,
+    1, 2, 0, 2, 3, 1, 0, 2,
+    -2, 1, 0, 0, 2, -2, -2, -2,
+    -2, -4, -2, -4, 4, 2, 4, -2,
+    -2, 0, 2, -4, -2, 0, -4, -2,
+    3, 4, 0, 3, 2, 2, 2, 2,
+    0, 1, -1, 0, 0, 0, 2, 0,
+    0, -2, -2, 6, 4, 6, 4, 2,
+    4, 3, 4, 2, 3, 4, 4, 1,
+    2, 2, 2, 2, 2, 2, 0, 1,
+    2, 0, 0, 0, 0, 1, 2, 0,
+    -2, -2, 6, 6, 6, 6, 4, 4,
+    5, 2, 2, 2, 3, 4, 3, 2,
+    1, 0, 1, 0, 0, -2, 6, 6,
+    4, 6, 4, 4, 2, 4, 3, 2,
+    2, 2, 0, 1, 2, 0, 6, 6,
+    4, 4, 2, 0, 4, 4
+  },
+  {
+    1, 2, 2, 2, 0, 2, 0, 1,
+    2, 2, 1, 2, 0, 1, 1, 2,
+    1, 1, 0, 2, 2, 0, 2, 2,
+    1, 0, 0, 1, 1, 2, 0, 1,
+    1, 1, 0, 2, 0, 2, 1, 2,
+    1, 1, 2, 1, 1, 1, 1, 0,
+    1, 0, 1, 0, 2, 2, 0, 2,
+    0, 2, 0, 2, 1, 2, 1, 0,
+    0, 0, 1, 2, 0, 2, 2, 1,
+    1, 1, 2, 2, 2, 2, 2, 1,
+    2, 1, 0, 2, 2, 1, 1, 3,
+    0, 1, 0, 1, 1, 2, 1, 1,
+    2, 2, 0, 1, 0, 2, 1, 2,
+    2, 1, 0, 1, 2, 1, 2, 1,
+    0, 1, 2, 2, 1, 2, 0, 0,
+    2, 1, 0, 2, 1, 1, 0, 0,
+    2, 0, 1, 2, 1, 1, 2, 0,
+    0, 2, 1, 2, 1, 1, 1, 0,
+    1, 1, 2, 0, 2, 2, 2, 1,
+    1, 1, 0, 0, 1, 1, 1, 2,
+    0, 0, 2, 3, 0, 1, 1, 1,
+    2, 2, 0, 1, 2, 2, 1, 1,
+    1, 1, 0, 1, 1, 2, 1, 2,
+    1, 1, 2, 1, 1, 1, 2, 1,
+    2, 2, 1, 1, 1, 0, 1, 0,
+    2, 2, 1, 0, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 3, 2,
+    1, 1, 1, 2, 1, 1, 2, 2,
+    0, 1, 1, 2, 1, 1, 2, 0,
+    0, 2, 2, 0, 2, 1, 0, 1,
+    2, 1, 1, 1, 1, 1, 1, 2,
+    0, 0, 0, 1, 0, 1, 2, 2,
+    1, 1, 1, 2, 1, 1, 2, 2,
+    0, 0, 2, 2, 1, 0, 1, 0,
+    1, 1, 2, 2, 3, 1, 1, 2,
+    1, 1, 2, 4, 2, 1, 0, 1,
+    2, 1, 0, 1, 2, 0, 2, 1,
+    1, 1, 1, 2, 2, 0, 0, 1,
+    2, 1, 1, 2, 2, 2, 0, 2,
+    1, 2, 2, 2, 1, 2, 0, 2,
+    2, 2, 1, 0, 2, 2, 3, 0,
+    4, 0, 0, 0, 1, 1, 2, 1,
+    2, 0, 2, 0, 0, 1, 0, 1,
+    1, 1, 1, 2, 1, 0, 1, 1,
+    1, 2, 0, 1, 0, 2, 1, 2,
+    2, 0, 2, 1, 3, 2, 0, 0,
+    2, 1, 2, 1, 2, 1, 2, 0,
+    1, 0, 1, 2, 2, 1, 1, 0,
+    2, 4, 1, 0, 1, 0, 2, 1,
+    2, 1, 1, 1, 1, 0, 0, 0,
+    2, 2, 2, 0, 0, 0, 0, 3,
+    0, 2, 1, 0, 2, 2, 0, 1,
+    1, 1, 0, 1, 2, 2, 2, 2,
+    2, 1, 0, 2, 2, 0, 1, 1,
+    0, 2, 2, 1, 1, 2, 2, 2,
+    1, 2, 2, 2, 1, 3, 3, 1,
+    1, 2, 1, 2, 2, 0, 2, 1,
+    2, 1, 1, 0, 0, 0, 2, 2,
+    0, 2, 0, 0, 1, 2, 0, 0,
+    2, 1, 1, 2, 1, 1, 2, 1,
+    1, 0, 1, 2, 1, 1, 1, 0,
+    2, 2, 2, 0, 1, 2, 0, 0,
+    2, 0, 0, 1, 2, 2, 1, 1,
+    2, 0, 1, 1, 1, 2, 0, 0,
+    1, 0, 0, 1, 2, 2, 2, 1,
+    4, 2, 0, 0, 1, 0, 0, 1,
+    0, 0, 0, 2, 1, 2, 1, 0,
+    1, 2, 2, 1, 1, 3, 1, 2,
+    2, 0, 0, 0, 0, 2, 1, 0,
+    0, 0, 1, 1, 0, 2, 0, 1,
+    2, 1, 1, 0, 0, 1, 1, 3,
+    1, 2, 2, 2, 0, 2, 2, 1,
+    1, 2, 0, 1, 1, 1, 1, 1,
+    2, 1, 1, 0, 3, 2, 2, 0,
+    2, 0, 2, 1, 3, 2, 1, 0,
+    1, 1, 2, 0, 0, 1, 2, 2,
+    2, 2, 0, 1, 0, 1, 0, 2,
+    3, 2, 2, 1, 1, 0, 0, 0,
+    0, 3, 2, 2, 3, 1, 2, 0,
+    1, 2, 0, 2, 1, 1, 1, 0,
+    2, 1, 0, 0, 1, 1, 2, 1,
+    1, 0, 2, 1, 1, 2, 2, 0,
+    2, 1, 1, 0, 2, 0, 2, 0,
+    0, 2, 2, 2, 1, 2, 2, 1,
+    1, 2, 2, 1, 2, 1
+  },
+};
+constexpr double kNutLsAmpTbl[kNutLsAmp][kNutLsN] = {
+  {
+    -17206.4161 * 10000, -1317.0906 * 10000, -227.6413 * 10000, 207.4554 * 10000, 147.5877 * 10000, -51.6821 * 10000, 71.1159 * 10000, -38.7298 * 10000,
+    -30.1461 * 10000, 21.5829 * 10000, 12.8227 * 10000, 12.3457 * 10000, 15.6994 * 10000, 6.3110 * 10000, -5.7976 * 10000, -5.9641 * 10000,
+    -5.1613 * 10000, 4.5893 * 10000, 6.3384 * 10000, -3.8571 * 10000, 3.2481 * 10000, -4.7722 * 10000, -3.1046 * 10000, 2.8593 * 10000,
+    2.0441 * 10000, 2.9243 * 10000, 2.5887 * 10000, -1.4053 * 10000, 1.5164 * 10000, -1.5794 * 10000, 2.1783 * 10000, -1.2873 * 10000,
+    -1.2654 * 10000, -1.0204 * 10000, 1.6707 * 10000, -0.7691 * 10000, -1.1024 * 10000, 0.7566 * 10000, -0.6637 * 10000, -0.7141 * 10000,
+    -0.6302 * 10000, 0.5800 * 10000, 0.6443 * 10000, -0.5774 * 10000, -0.5350 * 10000, -0.4752 * 10000, -0.4940 * 10000, 0.7350 * 10000,
+    0.4065 * 10000, 0.6579 * 10000, 0.3579 * 10000, 0.4725 * 10000, -0.3075 * 10000, -0.2904 * 10000, 0.4348 * 10000, -0.2878 * 10000,
+    -0.4230 * 10000, -0.2819 * 10000, -0.4056 * 10000, -0.2647 * 10000, -0.2294 * 10000, 0.2481 * 10000, 0.2179 * 10000, 0.3276 * 10000,
+    -0.3389 * 10000, 0.3339 * 10000, -0.1987 * 10000, -0.1981 * 10000, 0.4026 * 10000, 0.1660 * 10000, -0.1521 * 10000, 0.1314 * 10000,
+    -0.1283 * 10000, -0.1331 * 10000, 0.1383 * 10000, 0.1405 * 10000, 0.1290 * 10000, -0.1214 * 10000, 0.1146 * 10000, 0.1019 * 10000,
+    -0.1100 * 10000, -0.0970 * 10000, 0.1575 * 10000, 0.0934 * 10000, 0.0922 * 10000, 0.0815 * 10000, 0.0834 * 10000, 0.1248 * 10000,
+    0.1338 * 10000, 0.0716 * 10000, 0.1282 * 10000, 0.0742 * 10000, 0.1020 * 10000, 0.0715 * 10000, -0.0666 * 10000, -0.0667 * 10000,
+    -0.0704 * 10000, -0.0694 * 10000, -0.1014 * 10000, -0.0585 * 10000, -0.0949 * 10000, -0.0595 * 10000, 0.0528 * 10000, -0.0590 * 10000,
+    0.0570 * 10000, -0.0502 * 10000, -0.0875 * 10000, -0.0492 * 10000, 0.0535 * 10000, -0.0467 * 10000, 0.0591 * 10000, -0.0453 * 10000,
+    0.0766 * 10000, -0.0446 * 10000, -0.0488 * 10000, -0.0468 * 10000, -0.0421 * 10000, 0.0463 * 10000, -0.0673 * 10000, 0.0658 * 10000,
+    -0.0438 * 10000, -0.0390 * 10000, 0.0639 * 10000, 0.0412 * 10000, -0.0361 * 10000, 0.0360 * 10000, 0.0588 * 10000, -0.0578 * 10000,
+    -0.0396 * 10000, 0.0565 * 10000, -0.0335 * 10000, 0.0357 * 10000, 0.0321 * 10000, -0.0301 * 10000, -0.0334 * 10000, 0.0493 * 10000,
+    0.0494 * 10000, 0.0337 * 10000, 0.0280 * 10000, 0.0309 * 10000, -0.0263 * 10000, 0.0253 * 10000, 0.0245 * 10000, 0.0416 * 10000,
+    -0.0229 * 10000, 0.0231 * 10000, -0.0259 * 10000, 0.0375 * 10000, 0.0252 * 10000, -0.0245 * 10000, 0.0243 * 10000, 0.0208 * 10000,
+    0.0199 * 10000, -0.0208 * 10000, 0.0335 * 10000, -0.0325 * 10000, -0.0187 * 10000, 0.0197 * 10000, -0.0192 * 10000, -0.0188 * 10000,
+    0.0276 * 10000, -0.0286 * 10000, 0.0186 * 10000, -0.0219 * 10000, 0.0276 * 10000, -0.0153 * 10000, -0.0156 * 10000, -0.0154 * 10000,
+    -0.0174 * 10000, -0.0163 * 10000, -0.0228 * 10000, 0.0091 * 10000, 0.0175 * 10000, -0.0159 * 10000, 0.0141 * 10000, 0.0147 * 10000,
+    -0.0132 * 10000, 0.0159 * 10000, 0.0213 * 10000, 0.0123 * 10000, -0.0118 * 10000, 0.0144 * 10000, -0.0121 * 10000, -0.0134 * 10000,
+    -0.0105 * 10000, -0.0102 * 10000, 0.0120 * 10000, 0.0101 * 10000, -0.0113 * 10000, -0.0106 * 10000, -0.0129 * 10000, -0.0114 * 10000,
+    0.0113 * 10000, -0.0102 * 10000, -0.0094 * 10000, -0.0100 * 10000, 0.0087 * 10000, 0.0161 * 10000, 0.0096 * 10000, 0.0151 * 10000,
+    -0.0104 * 10000, -0.0110 * 10000, -0.0100 * 10000, 0.0092 * 10000, 0.0082 * 10000, 0.0082 * 10000, -0.0078 * 10000, -0.0077 * 10000,
+    0.0002 * 10000, 0.0094 * 10000, -0.0093 * 10000, -0.0083 * 10000, 0.0083 * 10000, -0.0091 * 10000, 0.0128 * 10000, -0.0079 * 10000,
+    -0.0083 * 10000, 0.0084 * 10000, 0.0083 * 10000, 0.0091 * 10000, -0.0077 * 10000, 0.0084 * 10000, -0.0092 * 10000, -0.0092 * 10000,
+    -0.0094 * 10000, 0.0068 * 10000, -0.0061 * 10000, 0.0071 * 10000, 0.0062 * 10000, -0.0063 * 10000, -0.0073 * 10000, 0.0115 * 10000,
+    -0.0103 * 10000, 0.0063 * 10000, 0.0074 * 10000, -0.0103 * 10000, -0.0069 * 10000, 0.0057 * 10000, 0.0094 * 10000, 0.0064 * 10000,
+    -0.0063 * 10000, -0.0038 * 10000, -0.0043 * 10000, -0.0045 * 10000, 0.0047 * 10000, -0.0048 * 10000, 0.0045 * 10000, 0.0056 * 10000,
+    0.0088 * 10000, -0.0075 * 10000, 0.0085 * 10000, 0.0049 * 10000, -0.0074 * 10000, -0.0039 * 10000, 0.0045 * 10000, 0.0051 * 10000,
+    -0.0040 * 10000, 0.0041 * 10000, -0.0042 * 10000, -0.0051 * 10000, -0.0042 * 10000, 0.0039 * 10000, 0.0046 * 10000, -0.0053 * 10000,
+    0.0082 * 10000, 0.0081 * 10000, 0.0047 * 10000, 0.0053 * 10000, -0.0045 * 10000, -0.0044 * 10000, -0.0033 * 10000, -0.0061 * 10000,
+    0.0028 * 10000, -0.0038 * 10000, -0.0033 * 10000, -0.0060 * 10000, 0.0048 * 10000, 0.0027 * 10000, 0.0038 * 10000, 0.0031 * 10000,
+    -0.0029 * 10000, 0.0028 * 10000, -0.0032 * 10000, 0.0045 * 10000, -0.0044 * 10000, 0.0028 * 10000, -0.0051 * 10000, -0.0036 * 10000,
+    0.0044 * 10000, 0.0026 * 10000, -0.0060 * 10000, 0.0035 * 10000, -0.0027 * 10000, 0.0047 * 10000, 0.0036 * 10000, -0.0036 * 10000,
+    -0.0035 * 10000, -0.0037 * 10000, 0.0032 * 10000, 0.0035 * 10000, 0.0032 * 10000, 0.0065 * 10000, 0.0047 * 10000, 0.0032 * 10000,
+    0.0037 * 10000, -0.0030 * 10000, -0.0032 * 10000, -0.0031 * 10000, 0.0037 * 10000, 0.0031 * 10000, 0.0049 * 10000, 0.0032 * 10000,
+    0.0023 * 10000, -0.0043 * 10000, 0.0026 * 10000, -0.0032 * 10000, -0.0029 * 10000, -0.0027 * 10000, 0.0030 * 10000, -0.0011 * 10000,
+    -0.0021 * 10000, -0.0034 * 10000, -0.0010 * 10000, -0.0036 * 10000, -0.0009 * 10000, -0.0012 * 10000, -0.0021 * 10000, -0.0029 * 10000,
+    -0.0015 * 10000, -0.0020 * 10000, 0.0028 * 10000, 0.0017 * 10000, -0.0022 * 10000, -0.0014 * 10000, 0.0024 * 10000, 0.0011 * 10000,
+    0.0014 * 10000, 0.0024 * 10000, 0.0018 * 10000, -0.0038 * 10000, -0.0031 * 10000, -0.0016 * 10000, 0.0029 * 10000, -0.0018 * 10000,
+    -0.0010 * 10000, -0.0017 * 10000, 0.0009 * 10000, 0.0016 * 10000, 0.0022 * 10000, 0.0020 * 10000, -0.0013 * 10000, -0.0017 * 10000,
+    -0.0014 * 10000, 0.0000 * 10000, 0.0014 * 10000, 0.0019 * 10000, -0.0034 * 10000, -0.0020 * 10000, 0.0009 * 10000, -0.0018 * 10000,
+    0.0013 * 10000, 0.0017 * 10000, -0.0012 * 10000, 0.0015 * 10000, -0.0011 * 10000, 0.0013 * 10000, -0.0018 * 10000, -0.0035 * 10000,
+    0.0009 * 10000, -0.0019 * 10000, -0.0026 * 10000, 0.0008 * 10000, -0.0010 * 10000, 0.0010 * 10000, -0.0021 * 10000, -0.0015 * 10000,
+    0.0009 * 10000, -0.0029 * 10000, -0.0019 * 10000, 0.0012 * 10000, 0.0022 * 10000, -0.0010 * 10000, -0.0020 * 10000, -0.0020 * 10000,
+    -0.0017 * 10000, 0.0015 * 10000, 0.0008 * 10000, 0.0014 * 10000, -0.0012 * 10000, 0.0025 * 10000, -0.0013 * 10000, -0.0014 * 10000,
+    0.0013 * 10000, -0.0017 * 10000, -0.0012 * 10000, -0.0010 * 10000, 0.0010 * 10000, -0.0015 * 10000, -0.0022 * 10000, 0.0028 * 10000,
+    0.0015 * 10000, 0.0023 * 10000, 0.0012 * 10000, 0.0029 * 10000, -0.0025 * 10000, 0.0022 * 10000, -0.0018 * 10000, 0.0015 * 10000,
+    -0.0023 * 10000, 0.0012 * 10000, -0.0008 * 10000, -0.0019 * 10000, -0.0010 * 10000, 0.0021 * 10000, 0.0023 * 10000, -0.0016 * 10000,
+    -0.0019 * 10000, -0.0022 * 10000, 0.0027 * 10000, 0.0016 * 10000, 0.0019 * 10000, 0.0009 * 10000, -0.0009 * 10000, -0.0009 * 10000,
+    -0.0008 * 10000, 0.0018 * 10000, 0.0016 * 10000, -0.0010 * 10000, -0.0023 * 10000, 0.0016 * 10000, -0.0012 * 10000, -0.0008 * 10000,
+    0.0030 * 10000, 0.0024 * 10000, 0.0010 * 10000, -0.0016 * 10000, -0.0016 * 10000, 0.0017 * 10000, -0.0024 * 10000, -0.0012 * 10000,
+    -0.0024 * 10000, -0.0023 * 10000, -0.0013 * 10000, -0.0015 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000,
+    0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0003 * 10000,
+    -0.0003 * 10000, -0.0005 * 10000, 0.0003 * 10000, 0.0003 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000,
+    0.0006 * 10000, 0.0005 * 10000, -0.0007 * 10000, -0.0012 * 10000, 0.0005 * 10000, 0.0003 * 10000, -0.0005 * 10000, 0.0003 * 10000,
+    -0.0007 * 10000, 0.0007 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0003 * 10000, -0.0003 * 10000, -0.0007 * 10000, -0.0004 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0007 * 10000, -0.0004 * 10000, 0.0004 * 10000, -0.0005 * 10000, 0.0005 * 10000,
+    -0.0005 * 10000, 0.0005 * 10000, -0.0008 * 10000, 0.0009 * 10000, 0.0006 * 10000, -0.0005 * 10000, 0.0003 * 10000, -0.0007 * 10000,
+    -0.0003 * 10000, 0.0005 * 10000, 0.0003 * 10000, -0.0003 * 10000, 0.0004 * 10000, 0.0003 * 10000, -0.0005 * 10000, 0.0004 * 10000,
+    0.0009 * 10000, 0.0004 * 10000, 0.0004 * 10000, -0.0003 * 10000, -0.0004 * 10000, 0.0009 * 10000, -0.0004 * 10000, -0.0004 * 10000,
+    0.0003 * 10000, 0.0008 * 10000, 0.0003 * 10000, -0.0003 * 10000, 0.0003 * 10000, 0.0003 * 10000, -0.0003 * 10000, 0.0006 * 10000,
+    0.0003 * 10000, -0.0003 * 10000, -0.0007 * 10000, 0.0009 * 10000, -0.0003 * 10000, -0.0003 * 10000, -0.0004 * 10000, -0.0005 * 10000,
+    -0.0013 * 10000, -0.0007 * 10000, 0.0010 * 10000, 0.0003 * 10000, 0.0010 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0007 * 10000, -0.0004 * 10000, 0.0004 * 10000, 0.0005 * 10000, 0.0005 * 10000, -0.0003 * 10000, -0.0003 * 10000, -0.0004 * 10000,
+    -0.0005 * 10000, 0.0006 * 10000, 0.0009 * 10000, 0.0005 * 10000, -0.0007 * 10000, -0.0003 * 10000, -0.0004 * 10000, 0.0007 * 10000,
+    -0.0004 * 10000, 0.0004 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0011 * 10000, 0.0003 * 10000, 0.0011 * 10000, -0.0003 * 10000,
+    -0.0001 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0003 * 10000, -0.0007 * 10000, 0.0005 * 10000, -0.0003 * 10000, 0.0003 * 10000,
+    0.0005 * 10000, -0.0007 * 10000, 0.0008 * 10000, -0.0004 * 10000, 0.0011 * 10000, -0.0003 * 10000, 0.0003 * 10000, -0.0004 * 10000,
+    0.0008 * 10000, 0.0003 * 10000, 0.0011 * 10000, -0.0006 * 10000, -0.0004 * 10000, -0.0008 * 10000, -0.0007 * 10000, -0.0004 * 10000,
+    0.0003 * 10000, 0.0006 * 10000, -0.0006 * 10000, 0.0006 * 10000, 0.0006 * 10000, 0.0005 * 10000, -0.0005 * 10000, -0.0004 * 10000,
+    -0.0004 * 10000, 0.0004 * 10000, 0.0006 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0005 * 10000, -0.0013 * 10000,
+    0.0003 * 10000, 0.0004 * 10000, 0.0007 * 10000, 0.0004 * 10000, 0.0005 * 10000, -0.0003 * 10000, -0.0006 * 10000, -0.0005 * 10000,
+    -0.0007 * 10000, 0.0005 * 10000, 0.0013 * 10000, -0.0004 * 10000, -0.0003 * 10000, 0.0005 * 10000, -0.0011 * 10000, 0.0005 * 10000,
+    0.0004 * 10000, 0.0004 * 10000, -0.0004 * 10000, 0.0006 * 10000, 0.0003 * 10000, -0.0012 * 10000, 0.0004 * 10000, -0.0003 * 10000,
+    -0.0004 * 10000, 0.0003 * 10000, 0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.0007 * 10000, 0.0006 * 10000, -0.0003 * 10000,
+    0.0005 * 10000, 0.0003 * 10000, 0.0003 * 10000, -0.0003 * 10000, -0.0005 * 10000, -0.0003 * 10000, -0.0003 * 10000, 0.0012 * 10000,
+    0.0003 * 10000, -0.0004 * 10000, 0.0004 * 10000, 0.0006 * 10000, 0.0005 * 10000, 0.0004 * 10000, -0.0006 * 10000, 0.0004 * 10000,
+    0.0006 * 10000, 0.0006 * 10000, -0.0006 * 10000, 0.0003 * 10000, 0.0007 * 10000, 0.0004 * 10000, -0.0005 * 10000, 0.0005 * 10000,
+    -0.0006 * 10000, -0.0006 * 10000, -0.0004 * 10000, 0.0010 * 10000, -0.0004 * 10000, 0.0007 * 10000, 0.0007 * 10000, 0.0004 * 10000,
+    0.0011 * 10000, 0.0005 * 10000, -0.0006 * 10000, 0.0004 * 10000, 0.0003 * 10000, 0.0005 * 10000, -0.0004 * 10000, -0.0004 * 10000,
+    -0.0003 * 10000, 0.0004 * 10000, 0.0003 * 10000, -0.0003 * 10000, -0.0003 * 10000, -0.0003 * 10000
+  },
+  {
+    -17.4666 * 10000, -0.1675 * 10000, -0.0234 * 10000, 0.0207 * 10000, -0.3633 * 10000, 0.1226 * 10000, 0.0073 * 10000, -0.0367 * 10000,
+    -0.0036 * 10000, -0.0494 * 10000, 0.0137 * 10000, 0.0011 * 10000, 0.0010 * 10000, 0.0063 * 10000, -0.0063 * 10000, -0.0011 * 10000,
+    -0.0042 * 10000, 0.0050 * 10000, 0.0011 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000,
+    0.0021 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0025 * 10000, 0.0010 * 10000, 0.0072 * 10000, 0.0000 * 10000, -0.0010 * 10000,
+    0.0011 * 10000, 0.0000 * 10000, -0.0085 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0021 * 10000, -0.0011 * 10000, 0.0021 * 10000,
+    -0.0011 * 10000, 0.0010 * 10000, 0.0000 * 10000, -0.0011 * 10000, 0.0000 * 10000, -0.0011 * 10000, -0.0011 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000
+  },
+  {
+    3.3386 * 10000, -1.3696 * 10000, 0.2796 * 10000, -0.0698 * 10000, 1.1817 * 10000, -0.0524 * 10000, -0.0872 * 10000, 0.0380 * 10000,
+    0.0816 * 10000, 0.0111 * 10000, 0.0181 * 10000, 0.0019 * 10000, -0.0168 * 10000, 0.0027 * 10000, -0.0189 * 10000, 0.0149 * 10000,
+    0.0129 * 10000, 0.0031 * 10000, -0.0150 * 10000, 0.0158 * 10000, 0.0000 * 10000, -0.0018 * 10000, 0.0131 * 10000, -0.0001 * 10000,
+    0.0010 * 10000, -0.0074 * 10000, -0.0066 * 10000, 0.0079 * 10000, 0.0011 * 10000, -0.0016 * 10000, 0.0013 * 10000, -0.0037 * 10000,
+    0.0063 * 10000, 0.0025 * 10000, -0.0010 * 10000, 0.0044 * 10000, -0.0014 * 10000, -0.0011 * 10000, 0.0025 * 10000, 0.0008 * 10000,
+    0.0002 * 10000, 0.0002 * 10000, -0.0007 * 10000, -0.0015 * 10000, 0.0021 * 10000, -0.0003 * 10000, -0.0021 * 10000, -0.0008 * 10000,
+    0.0006 * 10000, -0.0024 * 10000, 0.0005 * 10000, -0.0006 * 10000, -0.0002 * 10000, 0.0015 * 10000, -0.0010 * 10000, 0.0008 * 10000,
+    0.0005 * 10000, 0.0007 * 10000, 0.0005 * 10000, 0.0011 * 10000, -0.0010 * 10000, -0.0007 * 10000, -0.0002 * 10000, 0.0001 * 10000,
+    0.0005 * 10000, -0.0013 * 10000, -0.0006 * 10000, 0.0000 * 10000, -0.0353 * 10000, -0.0005 * 10000, 0.0009 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0008 * 10000, -0.0002 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0005 * 10000, -0.0003 * 10000, -0.0001 * 10000,
+    0.0009 * 10000, 0.0002 * 10000, -0.0006 * 10000, -0.0003 * 10000, -0.0001 * 10000, -0.0001 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    -0.0005 * 10000, -0.0002 * 10000, -0.0003 * 10000, 0.0001 * 10000, -0.0025 * 10000, -0.0004 * 10000, -0.0003 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, 0.0005 * 10000, -0.0001 * 10000, -0.0002 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000,
+    -0.0002 * 10000, 0.0003 * 10000, 0.0001 * 10000, -0.0003 * 10000, -0.0002 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0001 * 10000,
+    0.0001 * 10000, 0.0002 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0003 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, -0.0001 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0001 * 10000, -0.0001 * 10000, 0.0000 * 10000, -0.0002 * 10000,
+    -0.0002 * 10000, -0.0001 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0002 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0002 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0001 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, 0.0001 * 10000, -0.0002 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0001 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0001 * 10000,
+    0.0001 * 10000, 0.0002 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0028 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000,
+    -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0010 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.1988 * 10000, -0.0063 * 10000, 0.0000 * 10000, 0.0005 * 10000,
+    0.0000 * 10000, 0.0364 * 10000, -0.1044 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0330 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0012 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0013 * 10000, 0.0030 * 10000, -0.0162 * 10000, 0.0075 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, 0.0000 * 10000, -0.0013 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0026 * 10000, -0.0010 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000
+  },
+  {
+    9205.2331 * 10000, 573.0336 * 10000, 97.8459 * 10000, -89.7492 * 10000, 7.3871 * 10000, 22.4386 * 10000, -0.6750 * 10000, 20.0728 * 10000,
+    12.9025 * 10000, -9.5929 * 10000, -6.8982 * 10000, -5.3311 * 10000, -0.1235 * 10000, -3.3228 * 10000, 3.1429 * 10000, 2.5543 * 10000,
+    2.6366 * 10000, -2.4236 * 10000, -0.1220 * 10000, 1.6452 * 10000, -1.3870 * 10000, 0.0477 * 10000, 1.3238 * 10000, -1.2338 * 10000,
+    -1.0758 * 10000, -0.0609 * 10000, -0.0550 * 10000, 0.8551 * 10000, -0.8001 * 10000, 0.6850 * 10000, -0.0167 * 10000, 0.6953 * 10000,
+    0.6415 * 10000, 0.5222 * 10000, 0.0168 * 10000, 0.3268 * 10000, 0.0104 * 10000, -0.3250 * 10000, 0.3353 * 10000, 0.3070 * 10000,
+    0.3272 * 10000, -0.3045 * 10000, -0.2768 * 10000, 0.3041 * 10000, 0.2695 * 10000, 0.2719 * 10000, 0.2720 * 10000, -0.0051 * 10000,
+    -0.2206 * 10000, -0.0199 * 10000, -0.1900 * 10000, -0.0041 * 10000, 0.1313 * 10000, 0.1233 * 10000, -0.0081 * 10000, 0.1232 * 10000,
+    -0.0020 * 10000, 0.1207 * 10000, 0.0040 * 10000, 0.1129 * 10000, 0.1266 * 10000, -0.1062 * 10000, -0.1129 * 10000, -0.0009 * 10000,
+    0.0035 * 10000, -0.0107 * 10000, 0.1073 * 10000, 0.0854 * 10000, -0.0553 * 10000, -0.0710 * 10000, 0.0647 * 10000, -0.0700 * 10000,
+    0.0672 * 10000, 0.0663 * 10000, -0.0594 * 10000, -0.0610 * 10000, -0.0556 * 10000, 0.0518 * 10000, -0.0490 * 10000, -0.0527 * 10000,
+    0.0465 * 10000, 0.0496 * 10000, -0.0050 * 10000, -0.0399 * 10000, -0.0395 * 10000, -0.0422 * 10000, -0.0440 * 10000, -0.0170 * 10000,
+    -0.0039 * 10000, -0.0389 * 10000, -0.0023 * 10000, -0.0391 * 10000, -0.0495 * 10000, -0.0326 * 10000, 0.0369 * 10000, 0.0346 * 10000,
+    0.0304 * 10000, 0.0294 * 10000, 0.0004 * 10000, 0.0316 * 10000, 0.0008 * 10000, 0.0258 * 10000, -0.0279 * 10000, 0.0252 * 10000,
+    -0.0244 * 10000, 0.0250 * 10000, 0.0029 * 10000, 0.0275 * 10000, -0.0228 * 10000, 0.0240 * 10000, -0.0253 * 10000, 0.0244 * 10000,
+    0.0009 * 10000, 0.0225 * 10000, 0.0207 * 10000, 0.0201 * 10000, 0.0216 * 10000, -0.0200 * 10000, 0.0014 * 10000, -0.0002 * 10000,
+    0.0188 * 10000, 0.0205 * 10000, -0.0019 * 10000, -0.0176 * 10000, 0.0189 * 10000, -0.0185 * 10000, -0.0024 * 10000, 0.0005 * 10000,
+    0.0171 * 10000, -0.0006 * 10000, 0.0184 * 10000, -0.0154 * 10000, -0.0174 * 10000, 0.0162 * 10000, 0.0144 * 10000, -0.0015 * 10000,
+    -0.0019 * 10000, -0.0143 * 10000, -0.0144 * 10000, -0.0134 * 10000, 0.0131 * 10000, -0.0138 * 10000, -0.0128 * 10000, -0.0017 * 10000,
+    0.0128 * 10000, -0.0120 * 10000, 0.0109 * 10000, -0.0008 * 10000, -0.0108 * 10000, 0.0104 * 10000, -0.0104 * 10000, -0.0112 * 10000,
+    -0.0102 * 10000, 0.0105 * 10000, -0.0014 * 10000, 0.0007 * 10000, 0.0096 * 10000, -0.0100 * 10000, 0.0094 * 10000, 0.0083 * 10000,
+    -0.0002 * 10000, 0.0006 * 10000, -0.0079 * 10000, 0.0043 * 10000, 0.0002 * 10000, 0.0084 * 10000, 0.0081 * 10000, 0.0078 * 10000,
+    0.0075 * 10000, 0.0069 * 10000, 0.0001 * 10000, -0.0054 * 10000, -0.0075 * 10000, 0.0069 * 10000, -0.0072 * 10000, -0.0075 * 10000,
+    0.0069 * 10000, -0.0054 * 10000, -0.0004 * 10000, -0.0064 * 10000, 0.0066 * 10000, -0.0061 * 10000, 0.0060 * 10000, 0.0056 * 10000,
+    0.0057 * 10000, 0.0056 * 10000, -0.0052 * 10000, -0.0054 * 10000, 0.0059 * 10000, 0.0061 * 10000, 0.0055 * 10000, 0.0057 * 10000,
+    -0.0049 * 10000, 0.0044 * 10000, 0.0051 * 10000, 0.0056 * 10000, -0.0047 * 10000, -0.0001 * 10000, -0.0050 * 10000, -0.0005 * 10000,
+    0.0044 * 10000, 0.0048 * 10000, 0.0050 * 10000, 0.0012 * 10000, -0.0045 * 10000, -0.0045 * 10000, 0.0041 * 10000, 0.0043 * 10000,
+    0.0054 * 10000, -0.0040 * 10000, 0.0040 * 10000, 0.0040 * 10000, -0.0036 * 10000, 0.0039 * 10000, -0.0001 * 10000, 0.0034 * 10000,
+    0.0047 * 10000, -0.0044 * 10000, -0.0043 * 10000, -0.0039 * 10000, 0.0039 * 10000, -0.0043 * 10000, 0.0039 * 10000, 0.0039 * 10000,
+    0.0000 * 10000, -0.0036 * 10000, 0.0032 * 10000, -0.0031 * 10000, -0.0034 * 10000, 0.0033 * 10000, 0.0032 * 10000, -0.0002 * 10000,
+    0.0002 * 10000, -0.0028 * 10000, -0.0032 * 10000, 0.0003 * 10000, 0.0030 * 10000, -0.0029 * 10000, -0.0004 * 10000, -0.0033 * 10000,
+    0.0026 * 10000, 0.0020 * 10000, 0.0024 * 10000, 0.0023 * 10000, -0.0024 * 10000, 0.0025 * 10000, -0.0026 * 10000, -0.0025 * 10000,
+    0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0026 * 10000, -0.0001 * 10000, 0.0021 * 10000, -0.0020 * 10000, -0.0022 * 10000,
+    0.0021 * 10000, -0.0021 * 10000, 0.0024 * 10000, 0.0022 * 10000, 0.0022 * 10000, -0.0021 * 10000, -0.0018 * 10000, 0.0022 * 10000,
+    -0.0004 * 10000, -0.0004 * 10000, -0.0019 * 10000, -0.0023 * 10000, 0.0022 * 10000, -0.0002 * 10000, 0.0016 * 10000, 0.0001 * 10000,
+    -0.0015 * 10000, 0.0019 * 10000, 0.0021 * 10000, 0.0000 * 10000, -0.0010 * 10000, -0.0014 * 10000, -0.0020 * 10000, -0.0013 * 10000,
+    0.0015 * 10000, -0.0015 * 10000, 0.0015 * 10000, -0.0008 * 10000, 0.0019 * 10000, -0.0015 * 10000, 0.0000 * 10000, 0.0020 * 10000,
+    -0.0019 * 10000, -0.0014 * 10000, 0.0002 * 10000, -0.0018 * 10000, 0.0011 * 10000, -0.0001 * 10000, -0.0015 * 10000, 0.0020 * 10000,
+    0.0019 * 10000, 0.0019 * 10000, -0.0016 * 10000, -0.0014 * 10000, -0.0013 * 10000, -0.0002 * 10000, -0.0001 * 10000, -0.0016 * 10000,
+    -0.0016 * 10000, 0.0015 * 10000, 0.0016 * 10000, 0.0013 * 10000, -0.0016 * 10000, -0.0013 * 10000, -0.0002 * 10000, -0.0013 * 10000,
+    -0.0012 * 10000, 0.0018 * 10000, -0.0011 * 10000, 0.0014 * 10000, 0.0014 * 10000, 0.0012 * 10000, 0.0000 * 10000, 0.0005 * 10000,
+    0.0010 * 10000, 0.0015 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0005 * 10000, 0.0005 * 10000, -0.0001 * 10000,
+    0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0012 * 10000, 0.0007 * 10000, -0.0011 * 10000, -0.0006 * 10000,
+    -0.0006 * 10000, 0.0000 * 10000, -0.0008 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0008 * 10000, 0.0000 * 10000, 0.0010 * 10000,
+    0.0005 * 10000, 0.0010 * 10000, -0.0004 * 10000, -0.0006 * 10000, -0.0012 * 10000, 0.0000 * 10000, 0.0006 * 10000, 0.0009 * 10000,
+    0.0008 * 10000, -0.0007 * 10000, 0.0000 * 10000, -0.0010 * 10000, 0.0000 * 10000, 0.0008 * 10000, -0.0005 * 10000, 0.0007 * 10000,
+    -0.0006 * 10000, 0.0000 * 10000, 0.0005 * 10000, -0.0008 * 10000, 0.0003 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0004 * 10000, 0.0010 * 10000, 0.0011 * 10000, -0.0004 * 10000, 0.0004 * 10000, -0.0006 * 10000, 0.0009 * 10000, 0.0000 * 10000,
+    -0.0005 * 10000, 0.0000 * 10000, 0.0010 * 10000, -0.0005 * 10000, -0.0009 * 10000, 0.0005 * 10000, 0.0011 * 10000, 0.0000 * 10000,
+    0.0007 * 10000, -0.0003 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0006 * 10000, 0.0008 * 10000,
+    -0.0005 * 10000, 0.0009 * 10000, 0.0006 * 10000, 0.0005 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000,
+    -0.0007 * 10000, -0.0010 * 10000, -0.0005 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, -0.0005 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0004 * 10000, -0.0009 * 10000, -0.0001 * 10000, 0.0008 * 10000,
+    0.0009 * 10000, 0.0010 * 10000, -0.0001 * 10000, -0.0008 * 10000, -0.0008 * 10000, -0.0004 * 10000, 0.0004 * 10000, 0.0004 * 10000,
+    0.0004 * 10000, -0.0009 * 10000, -0.0001 * 10000, 0.0004 * 10000, 0.0009 * 10000, -0.0001 * 10000, 0.0006 * 10000, 0.0004 * 10000,
+    -0.0002 * 10000, -0.0010 * 10000, -0.0004 * 10000, 0.0007 * 10000, 0.0007 * 10000, -0.0007 * 10000, 0.0010 * 10000, 0.0005 * 10000,
+    0.0011 * 10000, 0.0009 * 10000, 0.0005 * 10000, 0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0002 * 10000,
+    0.0001 * 10000, 0.0002 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0002 * 10000,
+    0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0003 * 10000, 0.0002 * 10000,
+    0.0001 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0003 * 10000, 0.0002 * 10000, -0.0002 * 10000, 0.0003 * 10000, 0.0000 * 10000,
+    0.0002 * 10000, -0.0002 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, -0.0002 * 10000, -0.0001 * 10000, 0.0002 * 10000, -0.0002 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0002 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, -0.0001 * 10000, -0.0001 * 10000, 0.0001 * 10000, -0.0003 * 10000,
+    0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0004 * 10000, 0.0002 * 10000, -0.0002 * 10000, -0.0002 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0002 * 10000,
+    0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0002 * 10000,
+    0.0003 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0001 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, 0.0003 * 10000, -0.0003 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0001 * 10000, 0.0002 * 10000,
+    -0.0004 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0002 * 10000, 0.0004 * 10000, 0.0003 * 10000, 0.0002 * 10000,
+    -0.0001 * 10000, -0.0003 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    0.0002 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, -0.0002 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0002 * 10000, 0.0002 * 10000,
+    0.0003 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0002 * 10000,
+    0.0000 * 10000, -0.0002 * 10000, 0.0002 * 10000, -0.0003 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0004 * 10000, -0.0003 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0003 * 10000, 0.0002 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    -0.0001 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, -0.0002 * 10000, 0.0003 * 10000, -0.0002 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0003 * 10000, -0.0002 * 10000, -0.0004 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, 0.0003 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0002 * 10000, 0.0002 * 10000, -0.0002 * 10000, -0.0002 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0002 * 10000,
+    0.0002 * 10000, -0.0002 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0001 * 10000, 0.0002 * 10000
+  },
+  {
+    0.9086 * 10000, -0.3015 * 10000, -0.0485 * 10000, 0.0470 * 10000, -0.0184 * 10000, -0.0677 * 10000, 0.0000 * 10000, 0.0018 * 10000,
+    -0.0063 * 10000, 0.0299 * 10000, -0.0009 * 10000, 0.0032 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0011 * 10000,
+    0.0000 * 10000, -0.0010 * 10000, 0.0000 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0011 * 10000, 0.0010 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0042 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000
+  },
+  {
+    1.5377 * 10000, -0.4587 * 10000, 0.1374 * 10000, -0.0291 * 10000, -0.1924 * 10000, -0.0174 * 10000, 0.0358 * 10000, 0.0318 * 10000,
+    0.0367 * 10000, 0.0132 * 10000, 0.0039 * 10000, -0.0004 * 10000, 0.0082 * 10000, -0.0009 * 10000, -0.0075 * 10000, 0.0066 * 10000,
+    0.0078 * 10000, 0.0020 * 10000, 0.0029 * 10000, 0.0068 * 10000, 0.0000 * 10000, -0.0025 * 10000, 0.0059 * 10000, -0.0003 * 10000,
+    -0.0003 * 10000, 0.0013 * 10000, 0.0011 * 10000, -0.0045 * 10000, -0.0001 * 10000, -0.0005 * 10000, 0.0013 * 10000, -0.0014 * 10000,
+    0.0026 * 10000, 0.0015 * 10000, 0.0010 * 10000, 0.0019 * 10000, 0.0002 * 10000, -0.0005 * 10000, 0.0014 * 10000, 0.0004 * 10000,
+    0.0004 * 10000, -0.0001 * 10000, -0.0004 * 10000, -0.0005 * 10000, 0.0012 * 10000, -0.0003 * 10000, -0.0009 * 10000, 0.0004 * 10000,
+    0.0001 * 10000, 0.0002 * 10000, 0.0001 * 10000, 0.0003 * 10000, -0.0001 * 10000, 0.0007 * 10000, 0.0002 * 10000, 0.0004 * 10000,
+    -0.0002 * 10000, 0.0003 * 10000, -0.0002 * 10000, 0.0005 * 10000, -0.0004 * 10000, -0.0003 * 10000, -0.0002 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, 0.0001 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0139 * 10000, -0.0002 * 10000, 0.0004 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0004 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0002 * 10000, -0.0001 * 10000, -0.0001 * 10000,
+    0.0004 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0001 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0010 * 10000, 0.0002 * 10000, -0.0001 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, 0.0002 * 10000, -0.0001 * 10000, -0.0001 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000,
+    -0.0001 * 10000, 0.0002 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0001 * 10000,
+    0.0000 * 10000, 0.0001 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0011 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.1679 * 10000, -0.0027 * 10000, 0.0000 * 10000, 0.0004 * 10000,
+    0.0000 * 10000, 0.0176 * 10000, -0.0891 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0010 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0014 * 10000, -0.0138 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0001 * 10000, 0.0000 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0011 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000
+  },
+};
+
+// planetary
+constexpr unsigned int kNutPlN   = 687;  // 項数
+constexpr unsigned int kNutPlMul = 14;  // 引数の係数の列数
+constexpr unsigned int kNutPlAmp = 4;  // 振幅の列数
+constexpr int kNutPlMulTbl[kNutPlMul][kNutPlN] = {
+  {
+    0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 1, 0,
+    1, 0, -2, 0, 0, -2, -1, -2,
+    -1, -1, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -2, 0, -2, 0, 0,
+    0, -1, -1, -2, -2, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0,
+    0, 1, 0, -2, 0, 0, 0, 0,
+    0, 0, -2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 2, -2,
+    2, 2, -2, -2, -2, -2, -2, -1,
+    -1, 1, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 1, 1, 0,
+    0, 0, 0, -2, -2, 0, 0, 0,
+    -1, -1, 0, 0, -2, 0, 0, 0,
+    1, 0, -1, 0, 0, 0, 2, -2,
+    0, -2, 1, -2, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, -2, -2, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, -2, 0, 0,
+    0, 0, -2, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1,
+    1, -1, -1, -1, 1, -2, -1, -1,
+    -1, -1, 1, -1, -2, 1, -1, 1,
+    -1, -1, 0, -1, -1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -1, 0, 1, 0, 0,
+    -1, 2, 1, 0, -1, -2, 0, 0,
+    0, 0, -1, 1, -1, 2, 1, 1,
+    1, 0, 2, -1, -1, 1, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    1, 0, 1, 0, 0, -1, 0, 1,
+    0, 1, 0, 0, -1, 0, 0, 1,
+    1, 0, 0, 2, 0, 1, 0, 1,
+    0, 0, 0, 0, 0, 0, -1, 0,
+    1, 1, 0, 0, 2, 1, 0, 1,
+    0, 0, 0, -1, 1, 0, 0, 1,
+    0, 0, 1, 0, -2, 1, 0, -1,
+    -2, -1, 0, 1, 0, -1, 1, 0,
+    0, 0, 0, 1, 0, -1, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    1, 0, 0, 2, -1, 0, 1, 1,
+    0, -2, 0, 1, 0, 1, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    -1, -2, 0, 0, 0, 0, -1, 2,
+    0, 0, 1, 0, 1, 1, 0, 0,
+    0, 2, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 1, 1, 0, 0, 1,
+    0, 1, 0, 0, 0, 1, 1, 0,
+    0, 1, 0, 1, 0, 2, -1, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 1, 0, 0, 1, 0, -1,
+    0, 0, 0, 2, 2, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    0, -1, -1, 2, 1, 0, 0, 1,
+    0, 0, 2, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 2, 0, 0, 1,
+    0, 0, 1, 0, -1, 2, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    1, 0, 0, 2, 0, 0, -1, 2,
+    0, 2, 1, 0, 0, 1, 0, 0,
+    -1, 0, 0, 0, 0, -1, 2, 1,
+    -2, 0, 0, 0, 0, 1, 0, 0,
+    0, 1, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, -2, 0, 2, -1, 0, 0, 1,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 2, 2,
+    0, 0, 0, 0, 2, 2, 2, 2,
+    0, 1, 2, 2, 1, 2, 2, 2,
+    2, 2, 2, 1, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    1, 2, 2, 2, 2, 2, 2
+  },
+  {
+    0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, -1, 0, 0, 0, 0, 0,
+    -1, 0, -1, 0, 0, -1, -2, -1,
+    -1, -1, 2, 0, 1, 2, 0, 1,
+    -1, 1, 0, -2, 0, -1, 0, -1,
+    0, 2, 2, 2, 0, 2, 1, 0,
+    -1, 0, 1, 2, 0, -1, 0, -1,
+    0, 0, 1, 1, -1, 0, 0, -1,
+    0, -2, -1, 2, 2, -1, 0, 1,
+    2, 1, 2, -3, 0, 1, -1, 0,
+    0, 0, 0, -1, 0, -1, -2, 2,
+    -2, -2, 1, 1, 2, 2, 2, 1,
+    1, -2, 0, -2, 1, 0, -1, -1,
+    -2, 2, 0, -1, 0, -1, 0, 0,
+    -2, 0, 2, 0, 0, -1, -1, 0,
+    1, 2, 0, 2, 2, 0, 1, -2,
+    1, 0, -1, 0, 1, -1, 0, 0,
+    0, -2, 0, 0, 0, 1, -1, 2,
+    0, 2, 0, 1, -1, 0, 0, -1,
+    0, -1, 0, 1, 1, -1, -1, 0,
+    0, -1, 0, -1, 0, -2, 1, 0,
+    2, 0, 2, 2, -1, 0, -1, 0,
+    0, 0, -1, 0, 0, -1, 0, 1,
+    0, 0, -2, -2, -2, 2, 0, -1,
+    0, 0, 2, 0, 0, -2, -1, -1,
+    0, 1, 1, -2, -1, 0, 0, -1,
+    0, 0, -2, 0, 0, -1, 0, 0,
+    -1, 0, 0, 0, -2, 0, 0, -1,
+    0, 0, -1, 0, 1, -2, 0, 0,
+    0, 0, -2, 2, -2, 0, 0, 0,
+    -1, 0, 0, -2, 0, 0, 1, -2,
+    0, -2, -1, 0, 0, -1, 0, 0,
+    1, 0, 0, 0, 0, 1, -2, 1,
+    2, 0, 0, 0, 0, -1, 0, 0,
+    0, -1, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0,
+    0, 2, 0, -2, 1, 0, 0, -1,
+    0, 0, 0, -1, 0, 0, 2, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -2, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -1, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, -2,
+    -2, 0, 0, 2, -2, 2, 0, 0,
+    0, 2, 1, 2, 0, 0, -1, -1,
+    0, 2, 0, 2, 2, -2, -2, -2,
+    0, 0, -2, -2, 0, 0, 0, 0,
+    2, 1, 0, 0, 1, 0, 0, 0,
+    0, -2, 0, 1, 0, 2, 0, 0,
+    0, 0, 2, 0, 2, 0, 0, 0,
+    1, 0, 0, 2, 2, 0, 2
+  },
+  {
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    1, 0, 1, 0, 0, 0, 0, 1,
+    1, 1, 1, 0, 0, 1, 0, 2,
+    1, 1, 0, 2, 0, 1, 0, 1,
+    0, 1, 2, 0, 1, 0, 0, 1,
+    2, 1, 0, 0, 2, 1, 0, 1,
+    0, 0, 0, 0, 2, 1, 2, 1,
+    0, 0, 1, 1, 0, 2, 1, 0,
+    0, 1, 0, 1, 2, 1, 1, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    1, 1, 0, 1, 0, 0, 0, 0,
+    1, 0, 1, 1, 0, 1, 2, 1,
+    1, 1, 0, 1, 0, 1, 0, 0,
+    1, 1, 0, 0, 0, 1, 1, 2,
+    1, 0, 0, 1, 1, 1, 0, 1,
+    0, 1, 1, 1, 1, 2, 1, 1,
+    1, 1, 1, 1, 1, 0, 1, 0,
+    1, 0, 1, 1, 2, 1, 0, 1,
+    0, 1, 0, 1, 1, 1, 1, 0,
+    0, 0, 1, 2, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 0, 1, 0,
+    0, 0, 1, 0, 0, 2, 1, 0,
+    0, 0, 1, 1, 1, 0, 0, 1,
+    0, 0, 0, 2, 2, 1, 2, 2,
+    1, 0, 0, 1, 1, 0, 0, 1,
+    0, 0, 2, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 2, 0, 0, 1,
+    0, 0, 2, 1, 0, 1, 0, 0,
+    0, 0, 1, 0, 1, 0, 0, 0,
+    1, 0, 0, 2, 0, 1, 0, 1,
+    1, 1, 2, 0, 0, 1, 0, 0,
+    0, 1, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 1, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 1,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 1, 0, 0, 0, 1,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 1, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 1, 0, 0, 0, 0, 1, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    0, 1, 0, 0, 0, 1, 2, 2,
+    0, 0, 0, 0, 2, 2, 2, 2,
+    0, 2, 2, 2, 1, 2, 2, 2,
+    2, 2, 1, 0, 1, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    1, 2, 1, 2, 2, 2, 2
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 19, 2,
+    0, 0, 0, 3, 0, 0, 18, 0,
+    18, 0, -8, -8, -8, -8, 8, 8,
+    8, 0, 3, 0, 3, 0, 0, 0,
+    0, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    0, 17, 0, 0, 0, 0, 0, 0,
+    5, 5, 6, -6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -20, 20, 0, 0, 0, 0, 0, 0,
+    -6, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    0, 0, 3, 0, 3, 8, 8, -8,
+    0, 18, 0, 3, 0, 0, 0, 0,
+    -10, 0, 10, 0, 0, 0, 0, 0,
+    -3, 0, -18, 0, -8, -8, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0,
+    0, 3, -3, -3, 0, -5, 5, 5,
+    6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 3, 3, -3,
+    -3, -3, -3, -3, 0, 0, 0, 0,
+    0, 0, 0, -5, -5, -5, -5, -5,
+    -5, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 3, -3,
+    0, 0, -5, 0, 0, 0, 0, 0,
+    2, 2, 0, 0, 0, 0, 0, 0,
+    3, -6, -6, -2, -2, -2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -1, 0, 0,
+    0, 0, 1, 1, 1, -1, -1, -7,
+    -7, 4, 0, -4, 4, 0, -4, -4,
+    -4, -4, -4, -4, -4, 4, 2, 0,
+    1, 1, 0, 0, 0, 0, -1, -1,
+    -1, 1, 1, 1, 0, 0, 0, -1,
+    0, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 2, -2, -2, -2, -6, -6,
+    6, 0, -2, 0, 0, 3, 0, 0,
+    0, -5, 0, -3, -3, 3, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, 0, 0, 0, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, -8, -8,
+    0, 0, 0, 0, 0, -5, 0, 0,
+    0, 3, -3, -3, 0, -5, -5, -5,
+    5, 0, 0, 0, 0, 0, 2, 0,
+    0, -2, -2, 2, 2, 0, 0, 0,
+    -2, 0, 1, -1, -1, -1, -7, -7,
+    0, -4, -4, -4, 4, 0, 0, 0,
+    1, 1, -9, 0, 0, 0, 0, 0,
+    -2, -2, -6, -6, 6, 0, 0, 0,
+    0, 0, 0, 0, -5, 0, 0, -3,
+    3, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, -8, -8,
+    -8, 0, 0, 3, 0, 0, 0, 0,
+    0, -3, 0, -5, -5, 5, 5, 0,
+    0, 0, 2, 2, 0, 0, -1, -1,
+    -7, -7, 0, 0, -4, 4, 4, 4,
+    0, 0, 1, 1, 1, -9, 0, 1,
+    0, 0, 0, -2, -6, 6, 0, 0,
+    0, 0, 3, 3, 0, 0, 0, 0,
+    0, 0, -8, 0, 0, 0, 0, 0,
+    -8, -8, -8, 0, 0, -3, -5, 5,
+    5, 5, 2, 2, 2, 0, 0, 0,
+    7, 0, 4, 1, -9, -9, 0, 0,
+    -6, 6, 6, 0, 0, 3, 3, 3,
+    0, 0, 0, 0, 8, 5, 2, 2,
+    2, -7, 7, 4, 4, 4, 4, 0,
+    0, 0, 3, -8, 8, 5, 5, -9,
+    -9, -9, 9, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    1, 3, 0, 0, 0, 0, 0, 0,
+    1, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, -3, 0,
+    1, 0, 2, 0, -2, 0, -1, -2,
+    0, 0, 0, 10, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 1,
+    0, 2, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 1, 0
+  },
+  {
+    8, -8, 8, 0, -4, 4, 3, -3,
+    0, 4, -5, -4, 4, 6, 0, 0,
+    -1, 0, -1, 0, 0, 3, -21, -4,
+    -1, -1, 2, -7, 1, 2, -16, 1,
+    -17, 2, 13, 11, 13, 12, -13, -14,
+    -13, 2, -3, 2, -5, 2, 0, -1,
+    -2, -5, -4, 2, -5, -1, 0, -1,
+    0, 0, 3, 1, -1, -9, 5, -1,
+    0, -16, -1, 5, 9, -1, 0, 1,
+    -6, -7, -8, 7, 0, 1, -1, 0,
+    0, -8, -8, -9, 8, 8, -5, 2,
+    -6, -2, 1, 1, 2, 6, 2, 1,
+    20, -21, 8, -10, 1, 0, -1, -1,
+    8, -6, 0, -1, 0, -1, 0, 0,
+    -9, 7, 5, 9, -9, -3, 4, -1,
+    0, -2, -5, 2, -3, -13, -12, 11,
+    2, -16, -1, -7, -3, -1, 0, -4,
+    3, -2, -3, 4, 0, 1, 3, 2,
+    7, 2, 16, 1, 12, 13, 1, 0,
+    1, -2, -1, -4, 3, -1, -1, 0,
+    0, -6, 5, 4, -2, 6, -7, -8,
+    -8, -8, 2, 6, -1, 0, -1, 0,
+    0, 0, -1, 0, 0, -1, 0, 1,
+    -7, 7, -5, -8, 2, 4, 0, -1,
+    0, 0, -3, -4, 4, -2, -1, 0,
+    1, 2, 1, -2, -6, -5, -5, 4,
+    5, 5, 3, 5, 2, 1, 2, -2,
+    -3, -2, -2, 8, 6, 8, 8, 7,
+    8, -8, -1, 0, 1, -2, -6, 6,
+    4, -4, 3, 2, -7, 0, 0, 0,
+    -1, 0, 0, -2, 0, -5, -4, 3,
+    2, -4, 7, 3, -3, -4, -3, -3,
+    -2, -3, -5, -5, 5, 1, -2, 1,
+    -3, 10, 10, 3, 3, 2, -3, -3,
+    0, -1, 0, 0, 4, -4, 2, -4,
+    -4, 4, 3, -2, -5, 2, 0, -3,
+    -3, 3, -2, -3, -2, 2, 2, 11,
+    11, -4, 2, 4, -5, 1, 7, 6,
+    7, 6, 6, 5, 6, -6, -2, 0,
+    0, -1, -1, 1, -1, -7, 1, 1,
+    0, -1, -1, -2, -2, -1, 1, 1,
+    -6, -6, -3, -3, -4, -5, 5, -1,
+    -1, 1, -4, 4, 3, 4, 9, 9,
+    -9, 1, 2, -4, 4, -4, -1, 1,
+    1, 9, 3, 4, 4, -4, -4, 2,
+    -1, 1, 1, -1, 1, 1, 1, 4,
+    1, 2, 1, -1, -2, 14, 1, 5,
+    5, -1, 1, 3, -3, 1, 12, 12,
+    1, 1, 0, 0, 1, 5, 1, 1,
+    1, -6, 6, 6, -1, 7, 7, 6,
+    -7, -1, -1, 3, 1, -2, -2, -6,
+    6, 2, 1, -2, -2, 1, -5, 5,
+    2, 4, -3, 3, 2, 3, 10, 10,
+    3, 8, 5, 5, -5, 1, -2, 0,
+    0, 0, 13, -1, -2, 2, -2, 2,
+    5, 5, 8, 8, -8, 2, -3, 5,
+    5, 2, 2, 2, 10, 4, 4, 3,
+    -3, -3, -3, 2, -5, 2, 2, 2,
+    2, 3, 3, 2, -6, 15, 9, 2,
+    -2, 6, 2, 2, 2, 1, 2, 2,
+    -6, -2, -2, 6, 2, -5, 11, 11,
+    11, 11, 2, -3, 4, 1, -4, 1,
+    2, 7, 0, 6, 6, -6, -6, 2,
+    -1, 7, -1, -1, 6, 5, 4, 4,
+    9, 9, 4, 3, 4, -4, -4, -4,
+    2, -3, 1, 1, 1, 12, 3, -1,
+    7, 3, 3, 6, 7, -7, 6, 3,
+    3, 5, -2, -2, 3, 3, 3, 4,
+    3, 1, 16, 3, 7, -5, 3, -1,
+    10, 10, 10, 2, 3, 8, 5, -5,
+    -5, -5, 0, 0, 0, 7, 7, 6,
+    -8, 5, -3, 2, 11, 11, 4, 4,
+    6, -6, -6, 4, 6, -1, -1, -1,
+    4, 4, 5, 4, -9, -4, 1, 1,
+    1, 7, -7, -2, -2, -2, -2, 5,
+    5, 5, 0, 8, -8, -3, -3, 9,
+    9, 9, -9, -4, 6, 6, 6, 6,
+    6, 6, 6, 6, 0, 2, -2, 1,
+    -1, -3, 2, 4, 4, 4, 2, 1,
+    -1, -2, 1, 2, 2, 4, -1, -1,
+    4, 2, 2, 2, -3, -2, 3, -2,
+    -1, 1, -2, 1, 2, -1, 1, 3,
+    2, 1, 1, -3, 1, 1, 4, -4,
+    -4, -2, -2, 1, 1, 2, -3, -1,
+    1, -2, -1, 1, 2, 2, -4, 4,
+    1, 1, 1, 2, -3, -1, 2
+  },
+  {
+    -16, 16, -16, 0, 8, -8, -8, 0,
+    0, -8, 8, 8, -8, 4, 0, 0,
+    0, 0, 0, 0, 0, -7, 3, 0,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, -4, 0, 0, 17, 0, 0,
+    0, 0, 0, -6, -13, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 15, 15, 15, -15, -15, 0, 0,
+    8, 0, 0, 0, 0, -8, 0, 0,
+    0, 0, -15, 15, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    13, -13, -6, -17, 17, 4, 0, 2,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 4, 7, 0, 0, 8,
+    0, 0, 0, -8, 0, 0, -7, 0,
+    -4, 0, 0, 0, 0, 0, -2, -2,
+    -2, 2, 2, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0,
+    0, 15, 0, -8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    13, -13, 6, 11, 0, -4, 0, 0,
+    0, 0, 0, 8, -8, 0, 0, -2,
+    -2, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, -4, -4, 4,
+    4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 11, -11,
+    0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 4, 0, -6, 6, 6, 6, 6,
+    0, 0, 9, 9, -9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -8, 8, 0, 7,
+    7, -7, 0, 0, 10, 0, 0, 5,
+    5, -5, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -3, 3, 12, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0,
+    10, 10, 0, 7, 0, 8, -8, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, -6, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 2, 0, 0, -8,
+    -8, 0, 0, -8, 8, 0, 0, 0,
+    0, 0, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 0, 9,
+    -9, 0, 0, 0, 0, 0, 7, -7,
+    0, -5, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, 1, 0, 3,
+    0, 0, 0, 5, 0, 0, 7, 0,
+    0, 0, 0, 0, 0, 0, 9, -6,
+    -6, 0, 0, 0, 0, -4, -4, 0,
+    0, 0, 0, 0, 13, 0, 0, 0,
+    0, -2, -2, 0, 15, 0, -4, 0,
+    8, -8, 0, 0, 0, 0, 0, 0,
+    16, 8, 8, -8, 0, 4, 0, 0,
+    0, 0, 0, 0, -8, 0, 8, 2,
+    0, 0, 4, 0, 0, 0, 0, 0,
+    6, -9, 0, 0, -7, -5, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    -8, 0, 0, 0, 0, 0, -6, 0,
+    0, -4, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, -8, 16, 0, 8,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -7, -7, -5,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -8, -8, -8, 0, 0,
+    0, 0, 0, 0, 0, -8, 0, 0,
+    -8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -8, 8,
+    8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 8, -8,
+    0, 0, 0, 0, 0, 0, 0
+  },
+  {
+    4, -4, 4, 0, -1, 3, 3, 0,
+    -2, 3, -3, -3, 1, 0, 2, 2,
+    2, 2, -2, -2, -2, 0, 0, -3,
+    2, -4, 0, 0, 1, -2, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, -3, 2, -4, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1,
+    1, -2, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -5,
+    0, 3, -3, -3, -3, 0, -1, -1,
+    0, 0, 0, 0, 1, 1, 1, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, -3, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -2, -2, -3,
+    0, 0, 0, 3, 2, 2, 0, 0,
+    0, -2, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 1, 3, -1, -1,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, -3, 3, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, -1, 1, 0, 0,
+    0, 0, 0, 0, 0, 4, 2, 2,
+    2, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 0, 0, -2, 0,
+    0, 0, 0, 3, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, -4, 0,
+    0, 0, 3, 0, 0, 0, 0, 3,
+    3, -3, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 2, -2,
+    -1, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 1, 1, -1, -1, -3, 0,
+    0, 0, 0, 1, 0, 0, 2, 3,
+    3, 0, 0, 3, -3, -2, 0, 0,
+    1, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 0,
+    0, 0, 0, 0, 4, -4, 0, -3,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, -2, -2, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    -1, 3, 0, 0, 0, 0, 0, 0,
+    -4, -3, -3, 1, -2, 0, 0, 0,
+    0, 0, 0, 2, 3, 0, -3, 0,
+    1, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 0, 0, 0, -4, 0,
+    0, -3, -3, 0, 0, 0, 0, -2,
+    -2, 0, 0, 0, -1, -1, 0, 0,
+    0, -1, 0, 2, 3, -4, 0, -3,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, -3,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -4,
+    -3, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -1,
+    0, 0, -2, 3, 3, 3, -3, -1,
+    0, 0, 0, -3, -3, 3, 0, 0,
+    3, -2, -2, -2, 0, 2, 0, 2,
+    0, -1, 0, -1, 0, 1, 0, 0,
+    -2, 0, 0, 0, 0, 0, 3, -3,
+    -3, 3, 3, 0, 0, -2, 0, 0,
+    -1, 0, 1, 0, -3, -3, -3, 3,
+    0, 0, 0, -2, 0, 0, -2
+  },
+  {
+    5, -5, 5, 0, -5, 0, 0, 0,
+    6, 0, 0, 0, 5, 0, -5, -5,
+    -5, -5, 5, 5, 5, 0, 0, 0,
+    0, 10, -5, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 1, 0, 3, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 0, 0, 2,
+    -2, 0, -3, 0, 0, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, -1, -1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 5, 5, 0,
+    0, 0, 0, 0, -5, -5, 0, -5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, -1,
+    0, 0, 0, 0, 0, 0, -2, 3,
+    3, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -5, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -5, 0, 0, 0, 5, 0,
+    -2, 0, -1, 0, 0, 0, -5, 0,
+    0, 0, 0, 0, 0, 5, 0, 0,
+    -2, 1, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, -2,
+    -2, 0, 0, -1, 0, 0, 0, -5,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    -5, 0, 0, 5, 5, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0,
+    -1, 0, 0, -5, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, -1, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    2, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 2, 2, 2, 2, 1, 0, 0,
+    2, 0, 0, 1, 2, 2, 2, 1,
+    0, 0, 0, 1, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 1, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    2, 2, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 1, 2,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 1, 0, 0, 0, 0, 1,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 1, 0, 1, 2, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    1, 2, 0, 2, 1, 0, 0, 1,
+    0, 1, 2, 2, 0, 2, 1, 0,
+    1, 0, 0, 0, 0, 0, 2, 0,
+    2, 0, 0, 0, 0, 2, 0, 1,
+    0, 1, 2, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 1, 2,
+    0, 0, 2, 1, 0, 0, 0, 0,
+    0, 1, 2, 2, 1, 0, 0, 1,
+    1, 0, 1, 2, 0, 2, 0, 2,
+    1, 0, 0, 0, 2, 0, 2, 2,
+    1, 0, 1, 0, 0, 1, 2, 2,
+    1, 0, 0, 0, 0, 0, 1, 0,
+    2, 2, 1, 0, 1, 0, 0, 0,
+    0, 0, 2, 0, 2, 2, 2, 1,
+    0, 0, 1, 0, 2, 2, 0, 0,
+    2, 0, 0, 2, 0, 2, 0, 2,
+    1, 0, 0, 1, 0, 2, 2, 1,
+    0, 0, 0, 2, 0, 0, 2, 0,
+    0, 2, 0, 2, 1, 0, 1, 0,
+    0, 0, 0, 1, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0,
+    2, 1, 0, 0, 2, 2, 2, 0,
+    0, 2, 0, 2, 2, 0, 0, 1,
+    2, 0, 1, 2, 2, 2, 1, 0,
+    0, 0, 0, 2, 2, 2, 0, 2,
+    0, 1, 0, 0, 1, 2, 2, 0,
+    0, 0, 0, 1, 0, 2, 2, 1,
+    0, 2, 2, 1, 0, 2, 2, 2,
+    0, 2, 2, 2, 2, 0, 2, 0,
+    1, 2, 2, 1, 0, 0, 2, 0,
+    2, 0, 1, 2, 2, 0, 2, 1,
+    0, 1, 2, 0, 2, 0, 2, 0,
+    1, 0, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 0, 1, 0, 1, 2,
+    2, 2, 2, 2, 2, 2, 2, 1,
+    2, 2, 2, 2, 0, 0, 0, 2,
+    2, 2, 2, 2, 1, 0, 2, 2,
+    2, 2, 0, 2, 2, 2, 1, 2,
+    2, 1, 2, 2, 1, 0, 1, 2,
+    2, 2, 0, 1, 2, 2, 0, 0,
+    2, 0, 2, 2, 1, 0, 2, 0,
+    2, 2, 0, 2, 2, 2, 2, 2,
+    2, 0, 2, 2, 2, 2, 2, 2,
+    2, 1, 2, 2, 2, 2, 1, 0,
+    1, 2, 0, 1, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 1, 2, 2,
+    1, 0, 1, 2, 2, 0, 1, 2,
+    2, 2, 2, 0, 0, 2, 2, 1,
+    1, 1, 0, 1, 2, 0, 0, 2,
+    2, 2, 2, 1, 0, 1, 2, 1,
+    1, 1, 0, 1, 2, 0, 0, 1,
+    2, 0, 1, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0
+  },
+};
+constexpr double kNutPlAmpTbl[kNutPlAmp][kNutPlN] = {
+  {
+    0.1440 * 10000, 0.0056 * 10000, 0.0125 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0003 * 10000, -0.0114 * 10000, -0.0219 * 10000,
+    -0.0003 * 10000, -0.0462 * 10000, 0.0099 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0003 * 10000, -0.0012 * 10000, 0.0014 * 10000,
+    0.0031 * 10000, -0.0491 * 10000, -0.3084 * 10000, -0.1444 * 10000, 0.0011 * 10000, 0.0026 * 10000, 0.0103 * 10000, 0.0000 * 10000,
+    -0.0026 * 10000, 0.0009 * 10000, 0.0012 * 10000, -0.0007 * 10000, 0.0000 * 10000, 0.0284 * 10000, 0.0226 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0005 * 10000, -0.0041 * 10000, 0.0000 * 10000, 0.0425 * 10000, 0.1200 * 10000, 0.0235 * 10000, 0.0011 * 10000,
+    0.0005 * 10000, -0.0005 * 10000, 0.0006 * 10000, 0.0015 * 10000, 0.0013 * 10000, -0.0006 * 10000, 0.0266 * 10000, -0.0460 * 10000,
+    0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0017 * 10000,
+    -0.0009 * 10000, -0.0006 * 10000, -0.0016 * 10000, 0.0000 * 10000, 0.0011 * 10000, -0.0003 * 10000, 0.0003 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0006 * 10000, -0.0003 * 10000, -0.0005 * 10000, 0.0004 * 10000, -0.0042 * 10000,
+    -0.0010 * 10000, -0.0003 * 10000, 0.0078 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0007 * 10000, -0.0014 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0045 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, 0.0089 * 10000, 0.0000 * 10000, -0.0003 * 10000, -0.0349 * 10000, -0.0015 * 10000, -0.0003 * 10000, -0.0053 * 10000,
+    0.0005 * 10000, 0.0000 * 10000, 0.0015 * 10000, -0.0003 * 10000, -0.0021 * 10000, 0.0020 * 10000, 0.0000 * 10000, 0.0005 * 10000,
+    -0.0017 * 10000, 0.0000 * 10000, 0.0032 * 10000, 0.0174 * 10000, 0.0011 * 10000, -0.0066 * 10000, 0.0047 * 10000, 0.0000 * 10000,
+    0.0010 * 10000, -0.0003 * 10000, -0.0024 * 10000, 0.0005 * 10000, 0.0003 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0005 * 10000,
+    0.0008 * 10000, 0.0000 * 10000, 0.0010 * 10000, 0.0003 * 10000, -0.0005 * 10000, 0.0046 * 10000, -0.0014 * 10000, 0.0000 * 10000,
+    -0.0005 * 10000, -0.0068 * 10000, 0.0000 * 10000, 0.0010 * 10000, -0.0005 * 10000, -0.0003 * 10000, 0.0076 * 10000, 0.0084 * 10000,
+    0.0003 * 10000, -0.0003 * 10000, -0.0003 * 10000, -0.0082 * 10000, -0.0073 * 10000, -0.0009 * 10000, 0.0003 * 10000, -0.0003 * 10000,
+    -0.0009 * 10000, -0.0439 * 10000, 0.0057 * 10000, 0.0000 * 10000, -0.0004 * 10000, -0.0040 * 10000, 0.0023 * 10000, 0.0273 * 10000,
+    -0.0449 * 10000, -0.0008 * 10000, 0.0006 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0003 * 10000, -0.0048 * 10000, 0.0051 * 10000,
+    -0.0133 * 10000, 0.0000 * 10000, -0.0021 * 10000, 0.0000 * 10000, -0.0011 * 10000, -0.0018 * 10000, 0.0035 * 10000, 0.0000 * 10000,
+    0.0011 * 10000, -0.0005 * 10000, -0.0053 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0050 * 10000, -0.0013 * 10000,
+    -0.0091 * 10000, 0.0006 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0052 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.0004 * 10000,
+    -0.0004 * 10000, 0.0010 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, -0.0004 * 10000, -0.0008 * 10000,
+    0.0008 * 10000, 0.0000 * 10000, -0.0138 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0054 * 10000, 0.0000 * 10000, -0.0007 * 10000,
+    -0.0037 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0008 * 10000, -0.0009 * 10000, -0.0003 * 10000, -0.0145 * 10000, -0.0010 * 10000,
+    0.0011 * 10000, -0.2150 * 10000, -0.0012 * 10000, 0.0085 * 10000, 0.0004 * 10000, 0.0003 * 10000, -0.0086 * 10000, -0.0006 * 10000,
+    0.0009 * 10000, -0.0008 * 10000, -0.0051 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0031 * 10000, 0.0140 * 10000,
+    0.0057 * 10000, -0.0014 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0009 * 10000,
+    -0.0004 * 10000, 0.0005 * 10000, 0.0016 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0007 * 10000, -0.0025 * 10000, 0.0042 * 10000,
+    -0.0027 * 10000, 0.0009 * 10000, -0.1166 * 10000, -0.0005 * 10000, -0.0006 * 10000, -0.0008 * 10000, 0.0000 * 10000, 0.0117 * 10000,
+    -0.0004 * 10000, 0.0003 * 10000, -0.0005 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0004 * 10000, -0.0004 * 10000, -0.0024 * 10000,
+    0.0003 * 10000, 0.0000 * 10000, 0.0008 * 10000, 0.0003 * 10000, 0.0007 * 10000, -0.0003 * 10000, 0.0050 * 10000, 0.0000 * 10000,
+    0.0013 * 10000, 0.0000 * 10000, 0.0024 * 10000, 0.0005 * 10000, 0.0030 * 10000, 0.0018 * 10000, 0.0008 * 10000, 0.0003 * 10000,
+    0.0006 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.0127 * 10000, 0.0003 * 10000, -0.0006 * 10000, 0.0005 * 10000, 0.0016 * 10000,
+    0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0009 * 10000, 0.0017 * 10000,
+    0.0000 * 10000, -0.0020 * 10000, -0.0010 * 10000, -0.0004 * 10000, 0.0022 * 10000, -0.0004 * 10000, -0.0003 * 10000, -0.0016 * 10000,
+    0.0000 * 10000, 0.0004 * 10000, -0.0068 * 10000, 0.0027 * 10000, 0.0000 * 10000, -0.0025 * 10000, -0.0012 * 10000, 0.0003 * 10000,
+    0.0003 * 10000, 0.0490 * 10000, -0.0022 * 10000, -0.0007 * 10000, -0.0003 * 10000, -0.0046 * 10000, -0.0005 * 10000, 0.0002 * 10000,
+    0.0000 * 10000, -0.0028 * 10000, 0.0005 * 10000, 0.0000 * 10000, -0.0011 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0025 * 10000,
+    0.0005 * 10000, 0.1485 * 10000, -0.0007 * 10000, 0.0000 * 10000, -0.0006 * 10000, 0.0030 * 10000, -0.0004 * 10000, -0.0019 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0118 * 10000,
+    0.0000 * 10000, -0.0028 * 10000, 0.0005 * 10000, 0.0014 * 10000, 0.0000 * 10000, -0.0458 * 10000, 0.0000 * 10000, 0.0009 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0011 * 10000, 0.0006 * 10000, -0.0016 * 10000, 0.0000 * 10000, -0.0005 * 10000, -0.0166 * 10000,
+    0.0015 * 10000, 0.0010 * 10000, -0.0078 * 10000, 0.0000 * 10000, 0.0007 * 10000, -0.0005 * 10000, 0.0003 * 10000, 0.0005 * 10000,
+    0.0000 * 10000, -0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.1223 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000,
+    -0.0006 * 10000, -0.0368 * 10000, -0.0075 * 10000, 0.0011 * 10000, 0.0003 * 10000, -0.0003 * 10000, -0.0013 * 10000, 0.0021 * 10000,
+    -0.0003 * 10000, -0.0004 * 10000, 0.0008 * 10000, -0.0019 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0006 * 10000, -0.0008 * 10000,
+    -0.0001 * 10000, -0.0014 * 10000, 0.0006 * 10000, -0.0074 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0008 * 10000, 0.0000 * 10000,
+    -0.0262 * 10000, 0.0000 * 10000, -0.0007 * 10000, 0.0000 * 10000, -0.0019 * 10000, 0.0202 * 10000, -0.0008 * 10000, 0.0000 * 10000,
+    0.0016 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0035 * 10000, -0.0003 * 10000, 0.0006 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0012 * 10000, 0.0000 * 10000, -0.0598 * 10000, -0.0003 * 10000, -0.0005 * 10000, 0.0003 * 10000, 0.0005 * 10000,
+    0.0004 * 10000, 0.0016 * 10000, 0.0008 * 10000, 0.0008 * 10000, 0.0000 * 10000, 0.0113 * 10000, 0.0000 * 10000, 0.0004 * 10000,
+    0.0027 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000, -0.0013 * 10000, 0.0005 * 10000, -0.0018 * 10000,
+    -0.0004 * 10000, -0.0005 * 10000, -0.0003 * 10000, -0.0005 * 10000, 0.0017 * 10000, 0.0011 * 10000, 0.0000 * 10000, 0.0083 * 10000,
+    -0.0004 * 10000, 0.0000 * 10000, 0.0117 * 10000, -0.0005 * 10000, -0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0393 * 10000, -0.0004 * 10000, -0.0006 * 10000, -0.0003 * 10000, 0.0008 * 10000, 0.0018 * 10000, 0.0008 * 10000,
+    0.0089 * 10000, 0.0003 * 10000, 0.0054 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0154 * 10000, 0.0015 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0080 * 10000, 0.0000 * 10000, 0.0011 * 10000, 0.0061 * 10000, 0.0014 * 10000, -0.0011 * 10000,
+    0.0000 * 10000, 0.0123 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0089 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0123 * 10000, 0.0000 * 10000, 0.0012 * 10000, -0.0013 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    -0.0062 * 10000, -0.0011 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0085 * 10000,
+    0.0163 * 10000, -0.0063 * 10000, -0.0021 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0006 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0007 * 10000, -0.0003 * 10000, 0.0003 * 10000,
+    0.0074 * 10000, -0.0003 * 10000, 0.0026 * 10000, 0.0019 * 10000, 0.0006 * 10000, 0.0083 * 10000, 0.0000 * 10000, 0.0011 * 10000,
+    0.0003 * 10000, 0.0003 * 10000, -0.0004 * 10000, 0.0005 * 10000, -0.0339 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0018 * 10000, 0.0009 * 10000, -0.0008 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0006 * 10000, -0.0004 * 10000,
+    0.0067 * 10000, 0.0030 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0517 * 10000, 0.0000 * 10000, 0.0143 * 10000,
+    0.0029 * 10000, -0.0004 * 10000, -0.0006 * 10000, 0.0005 * 10000, -0.0025 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.0022 * 10000,
+    0.0050 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0059 * 10000,
+    0.0000 * 10000, -0.0008 * 10000, -0.0003 * 10000, 0.0004 * 10000, 0.0370 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0006 * 10000,
+    0.0000 * 10000, -0.0010 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0034 * 10000, 0.0000 * 10000, -0.0005 * 10000, -0.0037 * 10000,
+    0.0003 * 10000, 0.0040 * 10000, 0.0000 * 10000, -0.0184 * 10000, -0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0031 * 10000,
+    -0.0003 * 10000, -0.0007 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0019 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0028 * 10000, 0.0000 * 10000, 0.0008 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000,
+    -0.0009 * 10000, 0.0003 * 10000, 0.0017 * 10000, 0.0000 * 10000, 0.0019 * 10000, 0.0000 * 10000, 0.0014 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0013 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0008 * 10000, 0.0000 * 10000,
+    0.0006 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0003 * 10000, -0.0003 * 10000, 0.0006 * 10000, 0.0007 * 10000,
+    -0.0004 * 10000, 0.0004 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0005 * 10000, -0.0003 * 10000, 0.0004 * 10000,
+    -0.0005 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0013 * 10000, 0.0021 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0003 * 10000, 0.0020 * 10000, -0.0034 * 10000, -0.0019 * 10000, 0.0003 * 10000, -0.0003 * 10000, -0.0006 * 10000,
+    -0.0004 * 10000, 0.0003 * 10000, 0.0003 * 10000, 0.0004 * 10000, 0.0003 * 10000, 0.0006 * 10000, -0.0008 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0126 * 10000, -0.0005 * 10000, -0.0003 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0126 * 10000, 0.0003 * 10000, 0.0021 * 10000, 0.0000 * 10000, -0.0021 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0008 * 10000,
+    -0.0006 * 10000, -0.0003 * 10000, 0.0003 * 10000, -0.0003 * 10000, -0.0005 * 10000, 0.0024 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0024 * 10000, 0.0004 * 10000, 0.0013 * 10000, 0.0007 * 10000, 0.0003 * 10000, 0.0003 * 10000
+  },
+  {
+    0.0000 * 10000, -0.0117 * 10000, -0.0043 * 10000, 0.0005 * 10000, -0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0089 * 10000,
+    0.0000 * 10000, 0.1604 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0218 * 10000,
+    -0.0481 * 10000, 0.0128 * 10000, 0.5123 * 10000, 0.2409 * 10000, -0.0024 * 10000, -0.0009 * 10000, -0.0060 * 10000, -0.0013 * 10000,
+    -0.0029 * 10000, -0.0027 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0024 * 10000, 0.0000 * 10000, 0.0101 * 10000, -0.0008 * 10000,
+    -0.0006 * 10000, 0.0000 * 10000, 0.0175 * 10000, 0.0015 * 10000, 0.0212 * 10000, 0.0598 * 10000, 0.0334 * 10000, -0.0012 * 10000,
+    -0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0009 * 10000, -0.0078 * 10000, -0.0435 * 10000,
+    0.0015 * 10000, 0.0000 * 10000, 0.0131 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0004 * 10000, 0.0003 * 10000, -0.0019 * 10000,
+    -0.0011 * 10000, 0.0000 * 10000, 0.0008 * 10000, 0.0003 * 10000, 0.0024 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0008 * 10000,
+    0.0003 * 10000, 0.0005 * 10000, 0.0003 * 10000, 0.0004 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0024 * 10000, 0.0020 * 10000,
+    0.0233 * 10000, 0.0000 * 10000, -0.0018 * 10000, 0.0003 * 10000, -0.0003 * 10000, -0.0004 * 10000, -0.0008 * 10000, -0.0005 * 10000,
+    0.0000 * 10000, 0.0008 * 10000, 0.0008 * 10000, 0.0019 * 10000, -0.0022 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0003 * 10000,
+    0.0005 * 10000, -0.0016 * 10000, 0.0003 * 10000, 0.0007 * 10000, -0.0062 * 10000, 0.0022 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0008 * 10000, -0.0007 * 10000, 0.0000 * 10000, -0.0078 * 10000, -0.0070 * 10000, 0.0006 * 10000, 0.0003 * 10000,
+    -0.0004 * 10000, 0.0006 * 10000, 0.0015 * 10000, 0.0084 * 10000, 0.0056 * 10000, -0.0012 * 10000, 0.0008 * 10000, 0.0008 * 10000,
+    -0.0022 * 10000, 0.0000 * 10000, 0.0012 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0029 * 10000, -0.0004 * 10000,
+    -0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0066 * 10000, 0.0007 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, -0.0034 * 10000, 0.0014 * 10000, -0.0006 * 10000, -0.0004 * 10000, 0.0005 * 10000, 0.0017 * 10000, 0.0298 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0292 * 10000, 0.0017 * 10000, -0.0016 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0005 * 10000, 0.0000 * 10000, -0.0028 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0057 * 10000, 0.0007 * 10000, 0.0080 * 10000,
+    0.0430 * 10000, -0.0047 * 10000, 0.0047 * 10000, 0.0023 * 10000, 0.0000 * 10000, -0.0004 * 10000, -0.0110 * 10000, 0.0114 * 10000,
+    0.0000 * 10000, 0.0004 * 10000, -0.0006 * 10000, -0.0003 * 10000, -0.0021 * 10000, -0.0436 * 10000, -0.0007 * 10000, 0.0005 * 10000,
+    -0.0003 * 10000, -0.0003 * 10000, -0.0009 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0194 * 10000, 0.0052 * 10000,
+    0.0248 * 10000, 0.0049 * 10000, -0.0047 * 10000, 0.0005 * 10000, 0.0023 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000,
+    0.0008 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0008 * 10000, 0.0008 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000,
+    -0.0004 * 10000, 0.0015 * 10000, 0.0000 * 10000, -0.0007 * 10000, -0.0007 * 10000, 0.0000 * 10000, 0.0010 * 10000, 0.0000 * 10000,
+    0.0035 * 10000, 0.0004 * 10000, 0.0009 * 10000, 0.0000 * 10000, -0.0014 * 10000, -0.0009 * 10000, 0.0047 * 10000, 0.0040 * 10000,
+    -0.0049 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0153 * 10000, 0.0009 * 10000,
+    -0.0013 * 10000, 0.0012 * 10000, 0.0000 * 10000, -0.0268 * 10000, 0.0012 * 10000, 0.0007 * 10000, 0.0006 * 10000, 0.0027 * 10000,
+    0.0011 * 10000, -0.0039 * 10000, -0.0006 * 10000, 0.0015 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0011 * 10000, 0.0006 * 10000,
+    0.0010 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0022 * 10000, 0.0223 * 10000,
+    -0.0143 * 10000, 0.0049 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000,
+    0.0008 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0031 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0013 * 10000,
+    0.0000 * 10000, -0.0032 * 10000, 0.0012 * 10000, 0.0000 * 10000, 0.0013 * 10000, 0.0016 * 10000, 0.0000 * 10000, -0.0005 * 10000,
+    0.0000 * 10000, 0.0005 * 10000, 0.0005 * 10000, -0.0011 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0614 * 10000, -0.0003 * 10000,
+    0.0017 * 10000, -0.0009 * 10000, 0.0006 * 10000, 0.0021 * 10000, 0.0005 * 10000, -0.0010 * 10000, 0.0000 * 10000, 0.0009 * 10000,
+    0.0000 * 10000, 0.0022 * 10000, 0.0019 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0003 * 10000, 0.0003 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, 0.0034 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0087 * 10000, 0.0000 * 10000, -0.0006 * 10000, -0.0003 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0039 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000,
+    0.0066 * 10000, 0.0000 * 10000, 0.0093 * 10000, 0.0028 * 10000, 0.0013 * 10000, 0.0014 * 10000, 0.0000 * 10000, 0.0001 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0106 * 10000,
+    0.0021 * 10000, 0.0000 * 10000, -0.0032 * 10000, 0.0005 * 10000, -0.0003 * 10000, -0.0006 * 10000, 0.0004 * 10000, 0.0000 * 10000,
+    0.0004 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0011 * 10000, 0.0000 * 10000,
+    -0.0005 * 10000, 0.0036 * 10000, -0.0005 * 10000, -0.0059 * 10000, 0.0009 * 10000, 0.0000 * 10000, -0.0045 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0023 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0269 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0045 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0328 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, -0.0026 * 10000, 0.0007 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    0.0020 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0030 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0027 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0011 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0027 * 10000, -0.0008 * 10000, 0.0000 * 10000, 0.0035 * 10000, 0.0004 * 10000,
+    -0.0005 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.0048 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0005 * 10000, 0.0055 * 10000, 0.0005 * 10000, 0.0000 * 10000, -0.0013 * 10000, -0.0007 * 10000, 0.0000 * 10000, -0.0007 * 10000,
+    0.0000 * 10000, -0.0006 * 10000, -0.0003 * 10000, -0.0031 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0024 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0010 * 10000,
+    -0.0028 * 10000, 0.0006 * 10000, 0.0000 * 10000, -0.0009 * 10000, 0.0000 * 10000, 0.0004 * 10000, -0.0006 * 10000, 0.0015 * 10000,
+    0.0000 * 10000, -0.0114 * 10000, 0.0000 * 10000, 0.0019 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000,
+    -0.0006 * 10000, 0.0003 * 10000, 0.0021 * 10000, 0.0000 * 10000, 0.0008 * 10000, 0.0000 * 10000, -0.0029 * 10000, 0.0034 * 10000,
+    0.0000 * 10000, 0.0012 * 10000, -0.0015 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0035 * 10000, -0.0030 * 10000, 0.0000 * 10000,
+    0.0004 * 10000, 0.0009 * 10000, -0.0071 * 10000, -0.0020 * 10000, 0.0005 * 10000, -0.0096 * 10000, 0.0009 * 10000, -0.0006 * 10000,
+    -0.0003 * 10000, -0.0415 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0032 * 10000, -0.0009 * 10000, -0.0004 * 10000, 0.0000 * 10000,
+    -0.0086 * 10000, 0.0000 * 10000, -0.0416 * 10000, -0.0003 * 10000, -0.0006 * 10000, 0.0009 * 10000, -0.0015 * 10000, 0.0000 * 10000,
+    -0.0097 * 10000, 0.0005 * 10000, -0.0019 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0003 * 10000, 0.0004 * 10000, -0.0070 * 10000,
+    -0.0012 * 10000, -0.0016 * 10000, -0.0032 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0008 * 10000, 0.0010 * 10000, 0.0000 * 10000,
+    -0.0007 * 10000, -0.0004 * 10000, 0.0019 * 10000, -0.0173 * 10000, -0.0007 * 10000, -0.0012 * 10000, 0.0000 * 10000, -0.0004 * 10000,
+    0.0000 * 10000, 0.0012 * 10000, -0.0014 * 10000, 0.0000 * 10000, 0.0024 * 10000, 0.0000 * 10000, -0.0010 * 10000, -0.0003 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0023 * 10000, 0.0000 * 10000, -0.0010 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0004 * 10000, -0.0003 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0009 * 10000, -0.0009 * 10000, -0.0012 * 10000,
+    -0.0091 * 10000, -0.0018 * 10000, 0.0000 * 10000, -0.0114 * 10000, 0.0000 * 10000, 0.0016 * 10000, -0.0007 * 10000, -0.0003 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0012 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0012 * 10000,
+    0.0000 * 10000, 0.0007 * 10000, 0.0003 * 10000, 0.0004 * 10000, -0.0011 * 10000, 0.0004 * 10000, 0.0017 * 10000, 0.0000 * 10000,
+    -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0015 * 10000, -0.0008 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0003 * 10000,
+    0.0006 * 10000, 0.0000 * 10000, 0.0009 * 10000, 0.0017 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000, -0.0007 * 10000,
+    0.0013 * 10000, 0.0000 * 10000, -0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0010 * 10000, -0.0006 * 10000,
+    -0.0032 * 10000, 0.0000 * 10000, -0.0008 * 10000, -0.0004 * 10000, 0.0004 * 10000, 0.0003 * 10000, -0.0023 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, 0.0009 * 10000, 0.0000 * 10000, -0.0007 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0012 * 10000, -0.0003 * 10000, 0.0007 * 10000, 0.0000 * 10000, -0.0005 * 10000, -0.0003 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0009 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0011 * 10000, -0.0005 * 10000, -0.0005 * 10000, 0.0005 * 10000,
+    -0.0005 * 10000, 0.0000 * 10000, 0.0010 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, -0.0003 * 10000, -0.0063 * 10000, 0.0000 * 10000, 0.0028 * 10000, 0.0000 * 10000, 0.0009 * 10000, 0.0009 * 10000,
+    -0.0063 * 10000, 0.0000 * 10000, -0.0011 * 10000, -0.0004 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0012 * 10000, 0.0003 * 10000, 0.0003 * 10000,
+    0.0003 * 10000, -0.0012 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000
+  },
+  {
+    0.0000 * 10000, -0.0042 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0117 * 10000,
+    -0.0257 * 10000, 0.0000 * 10000, 0.2735 * 10000, -0.1286 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0007 * 10000,
+    -0.0016 * 10000, -0.0014 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0076 * 10000, 0.0006 * 10000, -0.0133 * 10000, 0.0319 * 10000, 0.0000 * 10000, -0.0007 * 10000,
+    0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0232 * 10000,
+    0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, -0.0010 * 10000,
+    0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0011 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0004 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0013 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0001 * 10000, -0.0002 * 10000, -0.0004 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0003 * 10000, -0.0004 * 10000, 0.0010 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, -0.0009 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0037 * 10000, 0.0003 * 10000, 0.0002 * 10000,
+    -0.0002 * 10000, 0.0003 * 10000, -0.0008 * 10000, 0.0045 * 10000, 0.0000 * 10000, -0.0006 * 10000, 0.0004 * 10000, 0.0004 * 10000,
+    -0.0012 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0015 * 10000, -0.0002 * 10000,
+    -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0035 * 10000, 0.0000 * 10000, 0.0002 * 10000,
+    0.0000 * 10000, -0.0018 * 10000, 0.0007 * 10000, -0.0003 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0009 * 10000, 0.0159 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0156 * 10000, 0.0009 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, -0.0015 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0030 * 10000, 0.0003 * 10000, 0.0043 * 10000,
+    0.0000 * 10000, -0.0025 * 10000, 0.0025 * 10000, 0.0013 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0059 * 10000, 0.0061 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, -0.0001 * 10000, -0.0011 * 10000, -0.0233 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    -0.0001 * 10000, -0.0001 * 10000, -0.0005 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0103 * 10000, 0.0028 * 10000,
+    0.0000 * 10000, 0.0026 * 10000, -0.0025 * 10000, 0.0003 * 10000, 0.0010 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000,
+    -0.0002 * 10000, 0.0007 * 10000, 0.0000 * 10000, -0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000,
+    0.0019 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0008 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0021 * 10000,
+    -0.0026 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0005 * 10000,
+    -0.0007 * 10000, 0.0006 * 10000, 0.0000 * 10000, -0.0116 * 10000, 0.0005 * 10000, 0.0003 * 10000, 0.0003 * 10000, 0.0014 * 10000,
+    0.0006 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0008 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000,
+    0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0119 * 10000,
+    -0.0077 * 10000, 0.0026 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0006 * 10000,
+    0.0000 * 10000, -0.0017 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000,
+    0.0000 * 10000, 0.0003 * 10000, 0.0002 * 10000, -0.0005 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000,
+    0.0009 * 10000, -0.0005 * 10000, 0.0003 * 10000, 0.0009 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0004 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0010 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0001 * 10000, 0.0001 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0001 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000,
+    0.0029 * 10000, 0.0000 * 10000, 0.0049 * 10000, 0.0015 * 10000, 0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0057 * 10000,
+    0.0011 * 10000, 0.0000 * 10000, -0.0017 * 10000, 0.0003 * 10000, -0.0002 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0031 * 10000, 0.0005 * 10000, 0.0000 * 10000, -0.0020 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0002 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0012 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0019 * 10000, 0.0002 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0021 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0029 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0007 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0016 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0010 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000,
+    0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0049 * 10000, 0.0000 * 10000, 0.0010 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, 0.0011 * 10000, -0.0001 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0013 * 10000, 0.0018 * 10000,
+    0.0000 * 10000, 0.0006 * 10000, -0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0013 * 10000, 0.0000 * 10000,
+    0.0002 * 10000, 0.0000 * 10000, -0.0031 * 10000, -0.0009 * 10000, 0.0002 * 10000, -0.0042 * 10000, 0.0004 * 10000, -0.0003 * 10000,
+    -0.0001 * 10000, -0.0180 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0017 * 10000, -0.0005 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    -0.0019 * 10000, -0.0019 * 10000, -0.0180 * 10000, -0.0001 * 10000, -0.0003 * 10000, 0.0004 * 10000, -0.0007 * 10000, 0.0000 * 10000,
+    -0.0042 * 10000, 0.0002 * 10000, -0.0008 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0002 * 10000, -0.0031 * 10000,
+    -0.0005 * 10000, -0.0007 * 10000, -0.0014 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0075 * 10000, -0.0003 * 10000, -0.0005 * 10000, 0.0000 * 10000, -0.0002 * 10000,
+    0.0000 * 10000, 0.0006 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0013 * 10000, 0.0000 * 10000, -0.0005 * 10000, -0.0001 * 10000,
+    0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0012 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000,
+    -0.0039 * 10000, -0.0008 * 10000, 0.0000 * 10000, -0.0050 * 10000, 0.0000 * 10000, 0.0007 * 10000, -0.0003 * 10000, -0.0001 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0005 * 10000,
+    0.0000 * 10000, 0.0004 * 10000, 0.0001 * 10000, 0.0002 * 10000, -0.0005 * 10000, 0.0002 * 10000, 0.0009 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0008 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0001 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0007 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0003 * 10000,
+    0.0007 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0006 * 10000, 0.0000 * 10000,
+    -0.0014 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0010 * 10000, 0.0000 * 10000,
+    0.0002 * 10000, 0.0005 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0001 * 10000, 0.0005 * 10000, -0.0001 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.0001 * 10000,
+    0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000,
+    0.0000 * 10000, -0.0002 * 10000, -0.0027 * 10000, 0.0001 * 10000, 0.0015 * 10000, 0.0001 * 10000, 0.0004 * 10000, 0.0004 * 10000,
+    -0.0027 * 10000, 0.0000 * 10000, -0.0006 * 10000, 0.0000 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0001 * 10000, 0.0001 * 10000,
+    0.0002 * 10000, -0.0005 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000
+  },
+  {
+    0.0000 * 10000, -0.0040 * 10000, -0.0054 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0061 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0053 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0008 * 10000,
+    -0.0017 * 10000, 0.0000 * 10000, 0.1647 * 10000, -0.0771 * 10000, -0.0009 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0014 * 10000, -0.0005 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0151 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0003 * 10000, 0.0017 * 10000, 0.0000 * 10000, 0.0269 * 10000, -0.0641 * 10000, 0.0000 * 10000, -0.0006 * 10000,
+    0.0003 * 10000, 0.0003 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0246 * 10000,
+    0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0009 * 10000,
+    -0.0005 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0001 * 10000, -0.0001 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0002 * 10000, -0.0002 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0001 * 10000, 0.0000 * 10000,
+    0.0003 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, -0.0048 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, -0.0008 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0011 * 10000, 0.0000 * 10000, -0.0002 * 10000,
+    0.0009 * 10000, 0.0000 * 10000, 0.0017 * 10000, -0.0093 * 10000, 0.0000 * 10000, 0.0035 * 10000, -0.0025 * 10000, 0.0000 * 10000,
+    -0.0005 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0002 * 10000,
+    -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0003 * 10000, -0.0025 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0036 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0003 * 10000, 0.0001 * 10000, -0.0041 * 10000, -0.0045 * 10000,
+    -0.0001 * 10000, 0.0002 * 10000, 0.0001 * 10000, 0.0044 * 10000, 0.0039 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000,
+    0.0005 * 10000, 0.0000 * 10000, -0.0030 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0021 * 10000, -0.0013 * 10000, -0.0146 * 10000,
+    0.0000 * 10000, 0.0004 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0002 * 10000, -0.0002 * 10000, 0.0026 * 10000, -0.0027 * 10000,
+    0.0057 * 10000, 0.0000 * 10000, 0.0011 * 10000, 0.0000 * 10000, 0.0006 * 10000, 0.0009 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0006 * 10000, 0.0003 * 10000, 0.0028 * 10000, 0.0001 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0027 * 10000, 0.0007 * 10000,
+    0.0000 * 10000, -0.0003 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0023 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0002 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000,
+    -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0029 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    0.0020 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0005 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0005 * 10000,
+    -0.0007 * 10000, 0.0932 * 10000, 0.0005 * 10000, -0.0037 * 10000, -0.0002 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    -0.0005 * 10000, 0.0004 * 10000, 0.0022 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0017 * 10000, -0.0075 * 10000,
+    -0.0030 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0002 * 10000, 0.0000 * 10000, -0.0009 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0003 * 10000, 0.0000 * 10000, -0.0022 * 10000,
+    0.0014 * 10000, -0.0005 * 10000, 0.0505 * 10000, 0.0002 * 10000, 0.0003 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0063 * 10000,
+    0.0002 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0003 * 10000, -0.0002 * 10000, 0.0002 * 10000, 0.0010 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0003 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0027 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0001 * 10000, -0.0011 * 10000, -0.0002 * 10000, -0.0016 * 10000, -0.0009 * 10000, 0.0000 * 10000, -0.0002 * 10000,
+    -0.0003 * 10000, 0.0002 * 10000, -0.0001 * 10000, 0.0055 * 10000, 0.0000 * 10000, 0.0003 * 10000, 0.0000 * 10000, -0.0007 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0004 * 10000, -0.0007 * 10000,
+    -0.0001 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0001 * 10000, 0.0007 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0014 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0006 * 10000, -0.0001 * 10000,
+    -0.0001 * 10000, -0.0213 * 10000, 0.0012 * 10000, 0.0004 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0015 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0001 * 10000, -0.0013 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0003 * 10000, -0.0013 * 10000, 0.0000 * 10000, 0.0010 * 10000,
+    -0.0001 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0052 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0008 * 10000, 0.0001 * 10000, 0.0198 * 10000, 0.0000 * 10000, -0.0005 * 10000,
+    0.0000 * 10000, -0.0001 * 10000, -0.0006 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    -0.0008 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0002 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0006 * 10000, -0.0002 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0001 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0006 * 10000, 0.0000 * 10000, 0.0032 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0114 * 10000, 0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, 0.0008 * 10000, -0.0087 * 10000, 0.0005 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0015 * 10000, 0.0001 * 10000, -0.0003 * 10000, -0.0001 * 10000,
+    0.0000 * 10000, -0.0006 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0002 * 10000, -0.0001 * 10000, 0.0000 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, -0.0049 * 10000, 0.0000 * 10000, -0.0002 * 10000,
+    0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, 0.0006 * 10000, -0.0002 * 10000, 0.0008 * 10000,
+    0.0000 * 10000, 0.0002 * 10000, 0.0001 * 10000, 0.0002 * 10000, -0.0007 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0002 * 10000, 0.0000 * 10000, -0.0051 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0003 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0008 * 10000, -0.0004 * 10000,
+    0.0000 * 10000, -0.0001 * 10000, -0.0024 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0067 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0035 * 10000, 0.0000 * 10000, -0.0005 * 10000, -0.0027 * 10000, -0.0006 * 10000, 0.0005 * 10000,
+    0.0000 * 10000, -0.0053 * 10000, -0.0035 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0038 * 10000,
+    -0.0006 * 10000, 0.0006 * 10000, 0.0053 * 10000, 0.0000 * 10000, -0.0005 * 10000, 0.0006 * 10000, 0.0000 * 10000, -0.0001 * 10000,
+    0.0027 * 10000, 0.0005 * 10000, 0.0000 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0037 * 10000,
+    -0.0072 * 10000, 0.0028 * 10000, 0.0009 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0001 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0002 * 10000, -0.0001 * 10000,
+    -0.0032 * 10000, 0.0002 * 10000, -0.0011 * 10000, -0.0008 * 10000, -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0005 * 10000,
+    -0.0001 * 10000, -0.0001 * 10000, 0.0000 * 10000, -0.0003 * 10000, 0.0147 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0004 * 10000, -0.0001 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000,
+    -0.0029 * 10000, -0.0013 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0023 * 10000, -0.0224 * 10000, 0.0000 * 10000, -0.0062 * 10000,
+    -0.0013 * 10000, 0.0002 * 10000, 0.0003 * 10000, -0.0002 * 10000, 0.0011 * 10000, 0.0001 * 10000, 0.0000 * 10000, 0.0010 * 10000,
+    -0.0022 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0002 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0160 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0004 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0015 * 10000, 0.0000 * 10000, 0.0002 * 10000, 0.0016 * 10000,
+    -0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0080 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0013 * 10000,
+    0.0001 * 10000, 0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0002 * 10000, -0.0010 * 10000,
+    0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0001 * 10000,
+    0.0004 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, 0.0000 * 10000,
+    -0.0005 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0003 * 10000, -0.0004 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    -0.0003 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, -0.0001 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0002 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0002 * 10000, 0.0001 * 10000, 0.0003 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, 0.0000 * 10000, -0.0001 * 10000, -0.0003 * 10000, 0.0003 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0000 * 10000, -0.0055 * 10000, 0.0002 * 10000, 0.0002 * 10000, -0.0002 * 10000, 0.0001 * 10000, -0.0001 * 10000,
+    0.0055 * 10000, -0.0001 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0011 * 10000, 0.0001 * 10000, 0.0000 * 10000, -0.0004 * 10000,
+    0.0003 * 10000, 0.0001 * 10000, -0.0001 * 10000, 0.0001 * 10000, 0.0002 * 10000, -0.0011 * 10000, 0.0000 * 10000, 0.0000 * 10000,
+    0.0000 * 10000, 0.0010 * 10000, -0.0002 * 10000, -0.0006 * 10000, -0.0003 * 10000, -0.0001 * 10000, -0.0001 * 10000
+  },
+};
+
+}  // namespace apparent_sun_moon
+
+#endif
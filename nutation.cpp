@@ -1,5 +1,12 @@
 #include "nutation.hpp"
 
+#include "nut_tbl.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define APPARENT_SUN_MOON_NUT_X86
+#include <immintrin.h>
+#endif
+
 namespace apparent_sun_moon {
 
 // 定数
@@ -8,10 +15,317 @@ static constexpr double kPi2    = kPi * 2;        // PI * 2
 static constexpr double kAs2R   = 4.848136811095359935899141e-6;  // Arcseconds to radians
 static constexpr double kTurnas = 1296000.0;      // Arcseconds in a full circle
 static constexpr double kU2R    = kAs2R / 1.0e7;  // Units of 0.1 microarcsecond to radians
+static constexpr double kJ2000  = 2451545.0;      // Reference epoch (J2000.0), Julian Date
+static constexpr double kJc     = 36525.0;        // Days per Julian century
+
+#ifdef APPARENT_SUN_MOON_NUT_X86
+// 引数の縮約用（π/2 を3分割; Cody-Waite）
+static constexpr double kPio2_1   = 1.57079632673412561417e+00;
+static constexpr double kPio2_2   = 6.07710050630396597660e-11;
+static constexpr double kPio2_3   = 2.02226624871116645580e-21;
+static constexpr double kInvPio2  = 6.36619772367581382433e-01;  // 2 / π
+// sin, cos の多項式近似の係数（|r| <= π/4）
+static constexpr double kSinCoef[6] = {
+   1.58962301576546568060e-10, -2.50507477628578072866e-08,
+   2.75573136213857245213e-06, -1.98412698295895385996e-04,
+   8.33333333332211858878e-03, -1.66666666666666307295e-01,
+};
+static constexpr double kCosCoef[6] = {
+  -1.13585365213876817300e-11,  2.08757008419747316778e-09,
+  -2.75573141792967388112e-07,  2.48015872888517045348e-05,
+  -1.38888888888730564116e-03,  4.16666666666665929218e-02,
+};
+
+/*
+ * @brief       sin, cos の同時計算（AVX2; 4要素並列）
+ *              * a = q * π/2 + r (|r| <= π/4) と縮約し、 r の多項式で近似
+ *              * 象限 q により sin, cos の入れ替え・符号反転を行う
+ *
+ * @param[in]   角度 (__m256d; rad)
+ * @param[ref]  sin (__m256d)
+ * @param[ref]  cos (__m256d)
+ */
+__attribute__((target("avx2")))
+static inline void sincos_avx2(__m256d a, __m256d& s, __m256d& c) {
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  __m256d q;
+  __m256d r;
+  __m256d z;
+  __m256d ps;
+  __m256d pc;
+  __m256d sr;
+  __m256d cr;
+  __m256d qm;
+  __m256d swap;
+  __m256d s_neg;
+  __m256d c_neg;
+  unsigned int k;
+
+  // 縮約
+  q = _mm256_round_pd(_mm256_mul_pd(a, _mm256_set1_pd(kInvPio2)),
+                      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  r = _mm256_sub_pd(a, _mm256_mul_pd(q, _mm256_set1_pd(kPio2_1)));
+  r = _mm256_sub_pd(r, _mm256_mul_pd(q, _mm256_set1_pd(kPio2_2)));
+  r = _mm256_sub_pd(r, _mm256_mul_pd(q, _mm256_set1_pd(kPio2_3)));
+  z = _mm256_mul_pd(r, r);
+  // 多項式近似
+  ps = _mm256_set1_pd(kSinCoef[0]);
+  pc = _mm256_set1_pd(kCosCoef[0]);
+  for (k = 1; k < 6; ++k) {
+    ps = _mm256_add_pd(_mm256_mul_pd(ps, z), _mm256_set1_pd(kSinCoef[k]));
+    pc = _mm256_add_pd(_mm256_mul_pd(pc, z), _mm256_set1_pd(kCosCoef[k]));
+  }
+  sr = _mm256_add_pd(r, _mm256_mul_pd(_mm256_mul_pd(r, z), ps));
+  cr = _mm256_add_pd(
+      _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(_mm256_set1_pd(0.5), z)),
+      _mm256_mul_pd(_mm256_mul_pd(z, z), pc));
+  // 象限（q mod 4 = 0, 1, 2, 3）
+  qm = _mm256_sub_pd(q, _mm256_mul_pd(_mm256_set1_pd(4.0),
+       _mm256_floor_pd(_mm256_mul_pd(q, _mm256_set1_pd(0.25)))));
+  swap  = _mm256_or_pd(_mm256_cmp_pd(qm, _mm256_set1_pd(1.0), _CMP_EQ_OQ),
+                       _mm256_cmp_pd(qm, _mm256_set1_pd(3.0), _CMP_EQ_OQ));
+  s_neg = _mm256_cmp_pd(qm, _mm256_set1_pd(2.0), _CMP_GE_OQ);
+  c_neg = _mm256_or_pd(_mm256_cmp_pd(qm, _mm256_set1_pd(1.0), _CMP_EQ_OQ),
+                       _mm256_cmp_pd(qm, _mm256_set1_pd(2.0), _CMP_EQ_OQ));
+  s = _mm256_blendv_pd(sr, cr, swap);
+  c = _mm256_blendv_pd(cr, sr, swap);
+  s = _mm256_xor_pd(s, _mm256_and_pd(s_neg, sign));
+  c = _mm256_xor_pd(c, _mm256_and_pd(c_neg, sign));
+}
+
+/*
+ * @brief       級数の和（AVX2; 4項並列）
+ *              * 先頭から4項単位で計算し、 dp, de に加算
+ *                （残りの項は呼び出し元でスカラー計算）
+ *              * lunisolar: dp += (A0 + A1 t) sin + A2 cos, de += (A3 + A4 t) cos + A5 sin
+ *                planetary: dp += A0 sin + A1 cos,         de += A2 sin + A3 cos
+ *                （planetary の引数の係数の第2列(L')は使用しない）
+ *
+ * @param[in]   級数 (NutSeries)
+ * @param[in]   引数（列ごと; lunisolar: 5, planetary: 14） (const double*)
+ * @param[in]   Julian Century Number (double)
+ * @param[ref]  Δψ の和 (double; 0.1 μas)
+ * @param[ref]  Δε の和 (double; 0.1 μas)
+ * @return      計算済みの項数 (unsigned int)
+ */
+template <bool kIsLs>
+__attribute__((target("avx2")))
+static unsigned int nut_sum_avx2(const NutSeries& ser, const double* arg,
+                                 double t, double& dp, double& de) {
+  constexpr unsigned int n_col = kIsLs ? 5 : 14;
+  const unsigned int n4 = ser.n & ~3u;
+  const __m256d vt = _mm256_set1_pd(t);
+  __m256d      va[n_col];
+  __m256d      acc_p = _mm256_setzero_pd();
+  __m256d      acc_e = _mm256_setzero_pd();
+  __m256d      a;
+  __m256d      sa;
+  __m256d      ca;
+  __m256d      vm;
+  double       wk_p[4];
+  double       wk_e[4];
+  unsigned int i;
+  unsigned int k;
+
+  for (k = 0; k < n_col; ++k) { va[k] = _mm256_set1_pd(arg[k]); }
+  for (i = 0; i < n4; i += 4) {
+    a = _mm256_setzero_pd();
+    for (k = 0; k < n_col; ++k) {
+      if (!kIsLs && k == 1) { continue; }
+      vm = _mm256_cvtepi32_pd(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(ser.mul[k] + i)));
+      a = _mm256_add_pd(a, _mm256_mul_pd(vm, va[k]));
+    }
+    sincos_avx2(a, sa, ca);
+    if (kIsLs) {
+      acc_p = _mm256_add_pd(acc_p, _mm256_add_pd(
+          _mm256_mul_pd(_mm256_add_pd(_mm256_loadu_pd(ser.amp[0] + i),
+              _mm256_mul_pd(_mm256_loadu_pd(ser.amp[1] + i), vt)), sa),
+          _mm256_mul_pd(_mm256_loadu_pd(ser.amp[2] + i), ca)));
+      acc_e = _mm256_add_pd(acc_e, _mm256_add_pd(
+          _mm256_mul_pd(_mm256_add_pd(_mm256_loadu_pd(ser.amp[3] + i),
+              _mm256_mul_pd(_mm256_loadu_pd(ser.amp[4] + i), vt)), ca),
+          _mm256_mul_pd(_mm256_loadu_pd(ser.amp[5] + i), sa)));
+    } else {
+      acc_p = _mm256_add_pd(acc_p, _mm256_add_pd(
+          _mm256_mul_pd(_mm256_loadu_pd(ser.amp[0] + i), sa),
+          _mm256_mul_pd(_mm256_loadu_pd(ser.amp[1] + i), ca)));
+      acc_e = _mm256_add_pd(acc_e, _mm256_add_pd(
+          _mm256_mul_pd(_mm256_loadu_pd(ser.amp[2] + i), sa),
+          _mm256_mul_pd(_mm256_loadu_pd(ser.amp[3] + i), ca)));
+    }
+  }
+  _mm256_storeu_pd(wk_p, acc_p);
+  _mm256_storeu_pd(wk_e, acc_e);
+  dp += (wk_p[0] + wk_p[1]) + (wk_p[2] + wk_p[3]);
+  de += (wk_e[0] + wk_e[1]) + (wk_e[2] + wk_e[3]);
+
+  return n4;
+}
+#endif
+
+/*
+ * @brief       SIMD（AVX2）実装の使用可否（初回使用時に CPU を判定）
+ *              * NutEval::kScalar が設定されている場合は使用しない
+ *
+ * @param[in]   評価方法 (NutEval)
+ * @return      true|false
+ */
+static bool use_avx2(NutEval eval) {
+#ifdef APPARENT_SUN_MOON_NUT_X86
+  static const bool is_avx2 = []() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }();
+
+  return eval != NutEval::kScalar && is_avx2;
+#else
+  return false;
+#endif
+}
+
+/*
+ * @brief       引数の係数の絶対値の最大（列ごと）を設定
+ *
+ * @param[in]   引数の係数の列数 (unsigned int)
+ * @param[ref]  級数 (NutSeries)
+ */
+static void set_max_mul(unsigned int n_mul, NutSeries& ser) {
+  unsigned int c;
+  unsigned int i;
+  unsigned int v;
+
+  for (c = 0; c < 14; ++c) {
+    ser.max_mul[c] = 0;
+    if (c >= n_mul) { continue; }
+    for (i = 0; i < ser.n; ++i) {
+      v = static_cast<unsigned int>(std::abs(ser.mul[c][i]));
+      if (v > ser.max_mul[c]) { ser.max_mul[c] = v; }
+    }
+  }
+}
+
+/*
+ * @brief       級数の和（漸化式; 複素数の積による合成）
+ *              * 基本引数 x_k の整数倍 j * x_k の cos, sin を
+ *                e^{i j x} = e^{i (j - 1) x} * e^{i x} で事前計算（負の倍数は共役）し、
+ *                各項の e^{i a}（a = Σ m_k x_k）を複素数の積で合成する
+ *              * 項の順序・振幅の掛け方は直接計算（calc_lunisolar, calc_planetary）と同じ
+ *
+ * @param[in]   級数 (NutSeries; 係数の絶対値は kNutMulMax 以下)
+ * @param[in]   引数（列ごと; lunisolar: 5, planetary: 14） (const double*)
+ * @param[in]   Julian Century Number (double)
+ * @param[ref]  Δψ の和 (double; 0.1 μas)
+ * @param[ref]  Δε の和 (double; 0.1 μas)
+ */
+template <bool kIsLs>
+static void nut_sum_recur(const NutSeries& ser, const double* arg,
+                          double t, double& dp, double& de) {
+  constexpr unsigned int n_col = kIsLs ? 5 : 14;
+  constexpr unsigned int o     = kNutMulMax;  // 倍数 0 の位置
+  double       tc[n_col][2 * kNutMulMax + 1];  // cos(j * x_k)
+  double       ts[n_col][2 * kNutMulMax + 1];  // sin(j * x_k)
+  double       c_1;
+  double       s_1;
+  double       ca;
+  double       sa;
+  double       wk;
+  const double* const* am = ser.amp;
+  int          m;
+  int          i;
+  unsigned int j;
+  unsigned int k;
+
+  // 基本引数の整数倍の cos, sin
+  for (k = 0; k < n_col; ++k) {
+    c_1 = std::cos(arg[k]);
+    s_1 = std::sin(arg[k]);
+    tc[k][o] = 1.0;
+    ts[k][o] = 0.0;
+    for (j = 1; j <= ser.max_mul[k]; ++j) {
+      tc[k][o + j] = tc[k][o + j - 1] * c_1 - ts[k][o + j - 1] * s_1;
+      ts[k][o + j] = ts[k][o + j - 1] * c_1 + tc[k][o + j - 1] * s_1;
+      tc[k][o - j] =  tc[k][o + j];
+      ts[k][o - j] = -ts[k][o + j];
+    }
+  }
+
+  // 各項
+  for (i = ser.n - 1; i >= 0; --i) {
+    ca = 1.0;
+    sa = 0.0;
+    for (k = 0; k < n_col; ++k) {
+      if (!kIsLs && k == 1) { continue; }
+      m = ser.mul[k][i];
+      if (m == 0) { continue; }
+      wk = ca * tc[k][o + m] - sa * ts[k][o + m];
+      sa = sa * tc[k][o + m] + ca * ts[k][o + m];
+      ca = wk;
+    }
+    if (kIsLs) {
+      dp += (am[0][i] + am[1][i] * t) * sa + am[2][i] * ca;
+      de += (am[3][i] + am[4][i] * t) * ca + am[5][i] * sa;
+    } else {
+      dp += am[0][i] * sa + am[1][i] * ca;
+      de += am[2][i] * sa + am[3][i] * ca;
+    }
+  }
+}
+
+/*
+ * @brief       級数の評価に漸化式を使用するか
+ *              * NutEval::kRecur が設定され、かつ、引数の係数が上限内の場合のみ
+ *
+ * @param[in]   評価方法 (NutEval)
+ * @param[in]   級数 (NutSeries)
+ * @return      true|false
+ */
+static bool use_recur(NutEval eval, const NutSeries& ser) {
+  unsigned int c;
+
+  if (eval != NutEval::kRecur) { return false; }
+  for (c = 0; c < 14; ++c) {
+    if (ser.max_mul[c] > kNutMulMax) { return false; }
+  }
+
+  return true;
+}
+
+/*
+ * @brief      級数の表（[列][項]）から NutSeries を生成
+ *
+ * @param[in]  引数の係数 (int[M][N])
+ * @param[in]  振幅 (double[A][N])
+ * @return     級数 (NutSeries)
+ */
+template <unsigned int M, unsigned int A, unsigned int N>
+static NutSeries gen_series(const int(&mul)[M][N], const double(&amp)[A][N]) {
+  NutSeries    ser = {};
+  unsigned int c;
+
+  ser.n = N;
+  for (c = 0; c < M; ++c) { ser.mul[c] = mul[c]; }
+  for (c = 0; c < A; ++c) { ser.amp[c] = amp[c]; }
+  set_max_mul(M, ser);
+
+  return ser;
+}
 
 // static メンバ変数の初期化
-std::vector<std::vector<double>> Nutation::dat_ls;  // data of lunisolar parameters
-std::vector<std::vector<double>> Nutation::dat_pl;  // data of planetary parameters
+NutSrc    Nutation::src    = NutSrc::kSeries;  // 章動の計算方法
+NutEval   Nutation::eval   = NutEval::kDirect; // 級数の評価方法
+NutSeries Nutation::ser_ls = gen_series(kNutLsMulTbl, kNutLsAmpTbl);
+                                               // 級数: lunisolar
+NutSeries Nutation::ser_pl = gen_series(kNutPlMulTbl, kNutPlAmpTbl);
+                                               // 級数: planetary
+NutBuf    Nutation::buf_ls;                    // 級数: lunisolar（ファイル指定時）
+NutBuf    Nutation::buf_pl;                    // 級数: planetary（ファイル指定時）
+bool      Nutation::is_trc = false;            // 打ち切り級数を使用するか
+NutSeries Nutation::trc_ls = {};               // 打ち切り級数: lunisolar
+NutSeries Nutation::trc_pl = {};               // 打ち切り級数: planetary
+NutBuf    Nutation::tbf_ls;                    // 打ち切り級数: lunisolar（格納先）
+NutBuf    Nutation::tbf_pl;                    // 打ち切り級数: planetary（格納先）
+std::atomic<unsigned long> Nutation::gen{0};   // 設定の世代
 
 /*
  * @brief      コンストラクタ
@@ -19,19 +333,9 @@ std::vector<std::vector<double>> Nutation::dat_pl;  // data of planetary paramet
  * @param[in]  Julian Century Number(double)
  */
 Nutation::Nutation(double t) {
-  try {
-    // lunisolra, planetary パラメータ一覧取得
-    if (dat_ls.size() == 0 || dat_pl.size() == 0) {
-      dat_ls.reserve(50);   // 予めメモリ確保
-      dat_pl.reserve(250);  // 予めメモリ確保
-      File o_f;
-      if (!o_f.get_param_ls(dat_ls)) throw;
-      if (!o_f.get_param_pl(dat_pl)) throw;
-    }
-    this->t = t;
-  } catch (...) {
-    throw;
-  }
+  // lunisolar, planetary パラメータはビルド時生成の表（nut_tbl.hpp）を使用
+  // （set_param_file で指定された場合は、そのファイルの内容）
+  this->t = t;
 }
 
 /*
@@ -48,6 +352,7 @@ bool Nutation::calc_nutation(double& dpsi, double& deps) {
   double deps_pl;  // delta-eps for planetary
 
   try {
+    if (is_jpl()) { return calc_jpl(dpsi, deps); }
     if (!calc_lunisolar(dpsi_ls, deps_ls)) {
       std::cout << "[ERROR] Could not calculate delta-psi, "
                 << "delta-epsilon for lunisolar!" << std::endl;
@@ -67,10 +372,294 @@ bool Nutation::calc_nutation(double& dpsi, double& deps) {
   return true;
 }
 
+/*
+ * @brief      設定: 章動の計算方法
+ *             * 以降に生成する Nutation（Bpn）に適用される
+ *
+ * @param[in]  章動の計算方法 (NutSrc)
+ * @return     <none>
+ */
+void Nutation::set_src(NutSrc src) {
+  Nutation::src = src;
+  ++gen;
+}
+
+/*
+ * @brief      取得: 章動の計算方法
+ *
+ * @param      <none>
+ * @return     章動の計算方法 (NutSrc)
+ */
+NutSrc Nutation::get_src() {
+  return src;
+}
+
+/*
+ * @brief      設定: 級数の評価方法
+ *             * 以降の calc_nutation に適用される
+ *
+ * @param[in]  級数の評価方法 (NutEval)
+ * @return     <none>
+ */
+void Nutation::set_eval(NutEval eval) {
+  Nutation::eval = eval;
+  ++gen;
+}
+
+/*
+ * @brief      取得: 級数の評価方法
+ *
+ * @param      <none>
+ * @return     級数の評価方法 (NutEval)
+ */
+NutEval Nutation::get_eval() {
+  return eval;
+}
+
+/*
+ * @brief      判定: JPL 暦の章動を使用するか
+ *             * NutSrc::kJpl が設定され、かつ、
+ *               暦に章動の係数が含まれる（ipts[11][1] > 0）場合のみ true
+ *
+ * @param      <none>
+ * @return     true|false
+ */
+bool Nutation::is_jpl() {
+  if (src != NutSrc::kJpl) { return false; }
+
+  return JplEph::get().hdr.ipts[11][1] > 0;
+}
+
+/*
+ * @brief      取得: 設定の世代
+ *             * 章動の値に影響する設定（set_src, set_eval, set_param_file,
+ *               set_truncation）の変更ごとに加算される
+ *             * 設定に依存する値を保持する側（BpnCache 等）の無効化判定に使用
+ *
+ * @param      <none>
+ * @return     設定の世代 (unsigned long)
+ */
+unsigned long Nutation::get_gen() {
+  return gen;
+}
+
+/*
+ * @brief      設定: 級数ファイル（実行時に上書き）
+ *             * ビルド時に生成した表の代わりに、指定ファイルの級数を使用する
+ *             * 書式は NUT_LS.txt, NUT_PL.txt と同じ
+ *             * 打ち切り級数（set_truncation）の設定は解除される
+ *
+ * @param[in]  lunisolar parameters のファイル名 (string)
+ * @param[in]  planetary parameters のファイル名 (string)
+ * @return     true|false
+ */
+bool Nutation::set_param_file(const std::string& f_ls, const std::string& f_pl) {
+  std::vector<std::vector<double>> dat_ls;  // data of lunisolar parameters
+  std::vector<std::vector<double>> dat_pl;  // data of planetary parameters
+  NutBuf    b_ls;                           // 格納先: lunisolar
+  NutBuf    b_pl;                           // 格納先: planetary
+  NutSeries s_ls = {};                      // 級数: lunisolar
+  NutSeries s_pl = {};                      // 級数: planetary
+
+  try {
+    File o_f;
+    if (!o_f.get_param_ls(dat_ls, f_ls)) { return false; }
+    if (!o_f.get_param_pl(dat_pl, f_pl)) { return false; }
+    if (!load_series(dat_ls, kNutLsMul, kNutLsAmp, b_ls, s_ls)) {
+      return false;
+    }
+    if (!load_series(dat_pl, kNutPlMul, kNutPlAmp, b_pl, s_pl)) {
+      return false;
+    }
+    // 両方とも正常に読み込めた場合のみ置き換え
+    // （vector の move では領域は移動しないため、 s_ls, s_pl のポインタは有効）
+    buf_ls = std::move(b_ls);
+    buf_pl = std::move(b_pl);
+    ser_ls = s_ls;
+    ser_pl = s_pl;
+    is_trc = false;  // 打ち切り級数は解除（必要なら再設定すること）
+    ++gen;
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief       設定: 打ち切り級数（精度指定）
+ *              * 項ごとの振幅の上限（|T| <= 期間 の範囲; Δψ, Δε 別）を求め、
+ *                振幅の小さい項から順に、除外した項の振幅の合計が
+ *                Δψ, Δε とも目標精度以内に収まる限り除外する
+ *              * 以降の calc_nutation は残りの項のみで計算する
+ *                （項の順序は元の級数のまま）
+ *              * 目標精度 <= 0 の場合は打ち切りを解除（全項を使用）
+ *
+ * @param[in]   目標精度 (double; mas)
+ * @param[in]   期間 (double; J2000.0 からのユリウス世紀数の絶対値の上限)
+ * @param[ref]  誤差の上限（除外した項の振幅の合計の Δψ, Δε の大きい方） (double; mas)
+ * @return      true|false
+ */
+bool Nutation::set_truncation(double acc, double span, double& bound) {
+  constexpr double kMas2U = 1.0e4;   // mas -> 0.1 μas
+  unsigned int n_ls = ser_ls.n;
+  unsigned int n    = ser_ls.n + ser_pl.n;
+  std::vector<double>       a_p(n);  // 振幅の上限: Δψ
+  std::vector<double>       a_e(n);  // 振幅の上限: Δε
+  std::vector<unsigned int> ords(n); // 振幅の昇順
+  std::vector<bool>         k_ls(ser_ls.n, true);  // 使用する項: lunisolar
+  std::vector<bool>         k_pl(ser_pl.n, true);  // 使用する項: planetary
+  double       s_p = 0.0;            // 除外した項の振幅の合計: Δψ
+  double       s_e = 0.0;            // 除外した項の振幅の合計: Δε
+  unsigned int i;
+  unsigned int j;
+
+  try {
+    bound = 0.0;
+    if (acc <= 0.0) {
+      is_trc = false;
+      ++gen;
+      return true;
+    }
+    span = std::fabs(span);
+    for (i = 0; i < n_ls; ++i) {
+      a_p[i] = std::fabs(ser_ls.amp[0][i]) + std::fabs(ser_ls.amp[1][i]) * span
+             + std::fabs(ser_ls.amp[2][i]);
+      a_e[i] = std::fabs(ser_ls.amp[3][i]) + std::fabs(ser_ls.amp[4][i]) * span
+             + std::fabs(ser_ls.amp[5][i]);
+    }
+    for (i = 0; i < ser_pl.n; ++i) {
+      a_p[n_ls + i] = std::fabs(ser_pl.amp[0][i]) + std::fabs(ser_pl.amp[1][i]);
+      a_e[n_ls + i] = std::fabs(ser_pl.amp[2][i]) + std::fabs(ser_pl.amp[3][i]);
+    }
+    for (i = 0; i < n; ++i) { ords[i] = i; }
+    std::stable_sort(ords.begin(), ords.end(),
+        [&a_p, &a_e](unsigned int x, unsigned int y) {
+          return std::max(a_p[x], a_e[x]) < std::max(a_p[y], a_e[y]);
+        });
+    for (i = 0; i < n; ++i) {
+      j = ords[i];
+      if (s_p + a_p[j] > acc * kMas2U || s_e + a_e[j] > acc * kMas2U) { break; }
+      s_p += a_p[j];
+      s_e += a_e[j];
+      if (j < n_ls) { k_ls[j] = false; } else { k_pl[j - n_ls] = false; }
+    }
+    copy_series(ser_ls, kNutLsMul, kNutLsAmp, k_ls, tbf_ls, trc_ls);
+    copy_series(ser_pl, kNutPlMul, kNutPlAmp, k_pl, tbf_pl, trc_pl);
+    is_trc = true;
+    ++gen;
+    bound = std::max(s_p, s_e) / kMas2U;
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
 // -------------------------------------
 // 以下、 private functions
 // -------------------------------------
 
+/*
+ * @brief       級数の格納（ファイル指定時）
+ *              * 行ごとのデータを列ごとの配列（SoA）に並べ替えて格納
+ *
+ * @param[in]   行ごとのデータ (vector<vector<double>>)
+ * @param[in]   引数の係数の列数 (unsigned int)
+ * @param[in]   振幅の列数 (unsigned int)
+ * @param[ref]  格納先 (NutBuf)
+ * @param[ref]  級数 (NutSeries)
+ * @return      true|false
+ */
+bool Nutation::load_series(
+    const std::vector<std::vector<double>>& dat,
+    unsigned int n_mul, unsigned int n_amp, NutBuf& buf, NutSeries& ser) {
+  unsigned int n = dat.size();
+  unsigned int i;
+  unsigned int c;
+
+  try {
+    for (i = 0; i < n; ++i) {
+      if (dat[i].size() != n_mul + n_amp) { return false; }
+    }
+    buf.mul.resize(n_mul * n);
+    buf.amp.resize(n_amp * n);
+    for (i = 0; i < n; ++i) {
+      for (c = 0; c < n_mul; ++c) {
+        buf.mul[c * n + i] = static_cast<int>(dat[i][c]);
+      }
+      for (c = 0; c < n_amp; ++c) {
+        buf.amp[c * n + i] = dat[i][n_mul + c];
+      }
+    }
+    ser.n = n;
+    for (c = 0; c < n_mul; ++c) { ser.mul[c] = buf.mul.data() + c * n; }
+    for (c = 0; c < n_amp; ++c) { ser.amp[c] = buf.amp.data() + c * n; }
+    set_max_mul(n_mul, ser);
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * @brief       級数の複製（指定項のみ）
+ *              * 項の順序は元の級数のまま
+ *
+ * @param[in]   元の級数 (NutSeries)
+ * @param[in]   引数の係数の列数 (unsigned int)
+ * @param[in]   振幅の列数 (unsigned int)
+ * @param[in]   使用する項 (vector<bool>)
+ * @param[ref]  格納先 (NutBuf)
+ * @param[ref]  級数 (NutSeries)
+ */
+void Nutation::copy_series(
+    const NutSeries& src, unsigned int n_mul, unsigned int n_amp,
+    const std::vector<bool>& keep, NutBuf& buf, NutSeries& ser) {
+  unsigned int n = std::count(keep.begin(), keep.end(), true);
+  unsigned int i;
+  unsigned int j;
+  unsigned int c;
+
+  buf.mul.resize(n_mul * n);
+  buf.amp.resize(n_amp * n);
+  for (i = 0, j = 0; i < src.n; ++i) {
+    if (!keep[i]) { continue; }
+    for (c = 0; c < n_mul; ++c) { buf.mul[c * n + j] = src.mul[c][i]; }
+    for (c = 0; c < n_amp; ++c) { buf.amp[c * n + j] = src.amp[c][i]; }
+    ++j;
+  }
+  ser = {};
+  ser.n = n;
+  for (c = 0; c < n_mul; ++c) { ser.mul[c] = buf.mul.data() + c * n; }
+  for (c = 0; c < n_amp; ++c) { ser.amp[c] = buf.amp.data() + c * n; }
+  set_max_mul(n_mul, ser);
+}
+
+/*
+ * @brief       計算: JPL 暦の章動（天体番号 14）
+ *              * 暦の章動は IAU 1980 章動理論に基づくため、
+ *                IAU 2000A 級数とは mas 程度の差がある
+ *
+ * @param[ref]  delta-psi(double)
+ * @param[ref]  delta-eps(double)
+ * @return      true|false
+ */
+bool Nutation::calc_jpl(double& dpsi, double& deps) {
+  try {
+    Jpl o_jpl(kJ2000 + t * kJc);
+    o_jpl.read_bin();
+    o_jpl.calc_pv(14, 0);
+    dpsi = o_jpl.pos[0];
+    deps = o_jpl.pos[1];
+  } catch (...) {
+    return false;
+  }
+
+  return true;
+}
+
 /*
  * @brief       計算: lunisolar
  *
@@ -90,6 +679,7 @@ bool Nutation::calc_lunisolar(double& dpsi, double& deps) {
   double dp = 0.0;  // work
   double de = 0.0;  // work
   int i;            // loop index
+  int i_0;          // loop index（スカラー計算の開始）
 
   try {
     l  = calc_l_iers2003();
@@ -97,14 +687,31 @@ bool Nutation::calc_lunisolar(double& dpsi, double& deps) {
     f  = calc_f_iers2003();
     d  = calc_d_mhb2000();
     om = calc_om_iers2003();
-    for (i = dat_ls.size() - 1; i >= 0; --i) {
-      a = dat_ls[i][0] * l + dat_ls[i][1] * lp + dat_ls[i][2] * f
-        + dat_ls[i][3] * d + dat_ls[i][4] * om;
+    const NutSeries& ser = is_trc ? trc_ls : ser_ls;  // 使用する級数
+    const int*    const* m  = ser.mul;
+    const double* const* am = ser.amp;
+    const double arg[5] = {l, lp, f, d, om};
+    // 漸化式（NutEval::kRecur）
+    if (use_recur(eval, ser)) {
+      nut_sum_recur<true>(ser, arg, t, dp, de);
+      dpsi = dp * kU2R;
+      deps = de * kU2R;
+      return true;
+    }
+    // SIMD（AVX2）で先頭から4項単位、残りはスカラーで計算
+    // （NutEval::kScalar の場合は全項スカラー）
+    i_0 = 0;
+#ifdef APPARENT_SUN_MOON_NUT_X86
+    if (use_avx2(eval)) { i_0 = nut_sum_avx2<true>(ser, arg, t, dp, de); }
+#endif
+    for (i = ser.n - 1; i >= i_0; --i) {
+      a = m[0][i] * l + m[1][i] * lp + m[2][i] * f
+        + m[3][i] * d + m[4][i] * om;
       a = fmod_p(a, kPi2);
       sa = std::sin(a);
       ca = std::cos(a);
-      dp += (dat_ls[i][5] + dat_ls[i][6] * t) * sa + dat_ls[i][ 7] * ca;
-      de += (dat_ls[i][8] + dat_ls[i][9] * t) * ca + dat_ls[i][10] * sa;
+      dp += (am[0][i] + am[1][i] * t) * sa + am[2][i] * ca;
+      de += (am[3][i] + am[4][i] * t) * ca + am[5][i] * sa;
     }
     dpsi = dp * kU2R;
     deps = de * kU2R;
@@ -142,6 +749,7 @@ bool Nutation::calc_planetary(double& dpsi, double& deps) {
   double dp = 0.0;  // work
   double de = 0.0;  // work
   int i;            // loop index
+  int i_0;          // loop index（スカラー計算の開始）
 
   try {
     l   = calc_l_mhb2000();
@@ -157,17 +765,35 @@ bool Nutation::calc_planetary(double& dpsi, double& deps) {
     lsa = calc_lsa_iers2003();
     lur = calc_lur_iers2003();
     lne = calc_lne_mhb2000();
-    for (i = dat_pl.size() - 1; i >= 0; --i) {
-      a = dat_pl[i][ 0] * l   + dat_pl[i][ 2] * f   + dat_pl[i][ 3] * d
-        + dat_pl[i][ 4] * om  + dat_pl[i][ 5] * lme + dat_pl[i][ 6] * lve
-        + dat_pl[i][ 7] * lea + dat_pl[i][ 8] * lma + dat_pl[i][ 9] * lju
-        + dat_pl[i][10] * lsa + dat_pl[i][11] * lur + dat_pl[i][12] * lne
-        + dat_pl[i][13] * pa;
+    const NutSeries& ser = is_trc ? trc_pl : ser_pl;  // 使用する級数
+    const int*    const* m  = ser.mul;
+    const double* const* am = ser.amp;
+    const double arg[14] = {l, 0.0, f, d, om, lme, lve, lea, lma, lju, lsa,
+                            lur, lne, pa};
+    // 漸化式（NutEval::kRecur）
+    if (use_recur(eval, ser)) {
+      nut_sum_recur<false>(ser, arg, t, dp, de);
+      dpsi = dp * kU2R;
+      deps = de * kU2R;
+      return true;
+    }
+    // SIMD（AVX2）で先頭から4項単位、残りはスカラーで計算
+    // （NutEval::kScalar の場合は全項スカラー）
+    i_0 = 0;
+#ifdef APPARENT_SUN_MOON_NUT_X86
+    if (use_avx2(eval)) { i_0 = nut_sum_avx2<false>(ser, arg, t, dp, de); }
+#endif
+    for (i = ser.n - 1; i >= i_0; --i) {
+      a = m[ 0][i] * l   + m[ 2][i] * f   + m[ 3][i] * d
+        + m[ 4][i] * om  + m[ 5][i] * lme + m[ 6][i] * lve
+        + m[ 7][i] * lea + m[ 8][i] * lma + m[ 9][i] * lju
+        + m[10][i] * lsa + m[11][i] * lur + m[12][i] * lne
+        + m[13][i] * pa;
       a = fmod_p(a, kPi2);
       sa = std::sin(a);
       ca = std::cos(a);
-      dp += dat_pl[i][14] * sa + dat_pl[i][15] * ca;
-      de += dat_pl[i][16] * sa + dat_pl[i][17] * ca;
+      dp += am[0][i] * sa + am[1][i] * ca;
+      de += am[2][i] * sa + am[3][i] * ca;
     }
     dpsi = dp * kU2R;
     deps = de * kU2R;
@@ -2,23 +2,94 @@
 #define APPARENT_SUN_MOON_NUTATION_HPP_
 
 #include "file.hpp"
+#include "jpl.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdlib>   // for abs
 #include <iostream>
+#include <string>
+#include <utility>  // for move
 #include <vector>
 
 namespace apparent_sun_moon {
 
+// 章動の計算方法
+// * Bpn::comp_nut は計算方法によらず IAU 2006 歳差に合わせた補正
+//   （Δψ に 0.4697e-6 + fj2 倍, Δε に fj2 倍を加算）を適用する。
+//   この補正は IAU 2000A 級数に対してのみ意味を持ち、 kJpl
+//   （DE430/440 等の章動は IAU 1980 章動理論に基づく）では、
+//   補正後の値も IAU 2000A/2006 とは mas 程度の差が残る。
+// * 級数との差・計算時間は nut_check（make nut_check）で確認できる。
+enum class NutSrc {
+  kSeries,  // IAU 2000A 級数（NUT_LS.txt, NUT_PL.txt）
+  kJpl,     // JPL 暦の章動（天体番号 14; 暦に含まれない場合は級数）
+};
+
+// 級数の評価方法
+// * 評価方法間の差・計算時間は nut_check recur, nut_check simd で確認できる。
+enum class NutEval {
+  kDirect,  // 項ごとに引数を縮約して sin, cos を計算（AVX2 が使用可能なら SIMD）
+  kRecur,   // 基本引数の整数倍の sin, cos を漸化式で事前計算し、複素数の積で合成
+  kScalar,  // kDirect と同じ計算を SIMD を使用せずに行う（比較・検証用）
+};
+
+constexpr unsigned int kNutMulMax = 32;  // kRecur で扱う引数の係数の絶対値の上限
+
+// 章動の級数（SoA; 列ごとの配列の先頭）
+// * 既定は nut_tbl.hpp（ビルド時に NUT_LS.txt, NUT_PL.txt から生成）の表
+// * 振幅は 0.1 μas 単位（10000 倍済み）
+struct NutSeries {
+  unsigned int  n;            // 項数
+  const int*    mul[14];      // 引数の係数（列ごと; lunisolar は 5 列）
+  const double* amp[6];       // 振幅（列ごと; planetary は 4 列）
+  unsigned int  max_mul[14];  // 引数の係数の絶対値の最大（列ごと）
+};
+
+// 章動の級数（ファイル指定時・打ち切り時の格納先; [列][項]）
+struct NutBuf {
+  std::vector<int>    mul;  // 引数の係数
+  std::vector<double> amp;  // 振幅
+};
+
 class Nutation {
-  static std::vector<std::vector<double>> dat_ls;  // data of lunisolar parameters
-  static std::vector<std::vector<double>> dat_pl;  // data of planetary parameters
+  static NutSrc    src;     // 章動の計算方法
+  static NutEval   eval;    // 級数の評価方法
+  static NutSeries ser_ls;  // 級数: lunisolar
+  static NutSeries ser_pl;  // 級数: planetary
+  static NutBuf    buf_ls;  // 級数: lunisolar（ファイル指定時）
+  static NutBuf    buf_pl;  // 級数: planetary（ファイル指定時）
+  static bool      is_trc;  // 打ち切り級数を使用するか
+  static NutSeries trc_ls;  // 打ち切り級数: lunisolar
+  static NutSeries trc_pl;  // 打ち切り級数: planetary
+  static NutBuf    tbf_ls;  // 打ち切り級数: lunisolar（格納先）
+  static NutBuf    tbf_pl;  // 打ち切り級数: planetary（格納先）
+  static std::atomic<unsigned long> gen;  // 設定の世代（設定の変更ごとに加算）
   double t;                                 // Julian Century Number for TT
 
 public:
   Nutation(double t);                       // コンストラクタ
   bool calc_nutation(double&, double&);     // 計算: nutation
+  static void   set_src(NutSrc);            // 設定: 章動の計算方法
+  static NutSrc get_src();                  // 取得: 章動の計算方法
+  static void    set_eval(NutEval);         // 設定: 級数の評価方法
+  static NutEval get_eval();                // 取得: 級数の評価方法
+  static bool   is_jpl();                   // 判定: JPL 暦の章動を使用するか
+  static bool   set_param_file(const std::string&, const std::string&);
+                                            // 設定: 級数ファイル（実行時に上書き）
+  static bool   set_truncation(double, double, double&);
+                                            // 設定: 打ち切り級数（精度指定）
+  static unsigned long get_gen();           // 取得: 設定の世代
 
 private:
+  static bool load_series(const std::vector<std::vector<double>>&,
+                          unsigned int, unsigned int, NutBuf&, NutSeries&);
+                                            // 級数の格納（ファイル指定時）
+  static void copy_series(const NutSeries&, unsigned int, unsigned int,
+                          const std::vector<bool>&, NutBuf&, NutSeries&);
+                                            // 級数の複製（指定項のみ）
+  bool calc_jpl(double&, double&);          // 計算: JPL 暦の章動
   bool calc_lunisolar(double&, double&);    // 計算: lunisolar
   bool calc_planetary(double&, double&);    // 計算: planetary
   double calc_l_iers2003();                 // Mean anomaly of the Moon (IERS 2003)
@@ -33,6 +33,25 @@ struct timespec jst2utc(struct timespec ts_jst) {
   return ts;
 }
 
+/*
+ * @brief      変換: UTC -> JST
+ *
+ * @param[in]  UTC (timespec)
+ * @return     JST (timespec)
+ */
+struct timespec utc2jst(struct timespec ts_utc) {
+  struct timespec ts;
+
+  try {
+    ts.tv_sec  = ts_utc.tv_sec + kJstOffset * kSecHour;
+    ts.tv_nsec = ts_utc.tv_nsec;
+  } catch (...) {
+    throw;
+  }
+
+  return ts;
+}
+
 /*
  * @brief      日時文字列生成
  *
@@ -40,19 +59,19 @@ struct timespec jst2utc(struct timespec ts_jst) {
  * @return     日時文字列 (string)
  */
 std::string gen_time_str(struct timespec ts) {
-  struct tm t;
+  DateTime dt;
   std::stringstream ss;
   std::string str_tm;
 
   try {
-    localtime_r(&ts.tv_sec, &t);
+    dt = ts2dt(ts);
     ss << std::setfill('0')
-       << std::setw(4) << t.tm_year + 1900 << "-"
-       << std::setw(2) << t.tm_mon + 1     << "-"
-       << std::setw(2) << t.tm_mday        << " "
-       << std::setw(2) << t.tm_hour        << ":"
-       << std::setw(2) << t.tm_min         << ":"
-       << std::setw(2) << t.tm_sec         << "."
+       << std::setw(4) << dt.year  << "-"
+       << std::setw(2) << dt.month << "-"
+       << std::setw(2) << dt.day   << " "
+       << std::setw(2) << dt.hour  << ":"
+       << std::setw(2) << dt.min   << ":"
+       << std::setw(2) << dt.sec   << "."
        << std::setw(3) << ts.tv_nsec / 1000000;
     return ss.str();
   } catch (...) {
@@ -61,8 +80,85 @@ std::string gen_time_str(struct timespec ts) {
 }
 
 // static メンバ変数の初期化
-std::vector<std::vector<std::string>> Time::l_ls  = {};  // List of Leap Second
-std::vector<std::vector<std::string>> Time::l_dut = {};  // List of DUT1
+std::vector<long>   Time::ls_day  = {};  // List of Leap Second（適用開始日の日数）
+std::vector<int>    Time::ls_val  = {};  // List of Leap Second（UTC - TAI）
+std::vector<long>   Time::dut_day = {};  // List of DUT1（適用開始日の日数）
+std::vector<double> Time::dut_val = {};  // List of DUT1（DUT1）
+std::once_flag      Time::flg_l;         // 一覧読み込み用
+
+/*
+ * @brief      検索: 対象日以前の最終要素（分岐なしの二分探索）
+ *             * 比較結果で先頭位置を条件付き移動（cmov）させるのみで、
+ *               ループ回数は要素数のみで決まる
+ *
+ * @param[in]  日数一覧 (vector<long>; 昇順)
+ * @param[in]  対象日の日数 (long)
+ * @return     インデックス (long; 該当なしの場合は -1)
+ */
+static long find_day(const std::vector<long>& days, long day) {
+  const long* base = days.data();
+  std::size_t n    = days.size();
+  std::size_t half;
+
+  if (n == 0) { return -1; }
+  while (n > 1) {
+    half = n / 2;
+    base = (base[half] <= day) ? base + half : base;
+    n   -= half;
+  }
+
+  return (*base <= day) ? base - days.data() : -1;
+}
+
+/*
+ * @brief      timespec のナノ秒の正規化（0 <= tv_nsec < 1e9）
+ *
+ * @param[ref] 日時 (timespec)
+ * @return     <none>
+ */
+static void norm_nsec(struct timespec& ts) {
+  if (ts.tv_nsec >= 1.0e9) {
+    ++ts.tv_sec;
+    ts.tv_nsec -= 1.0e9;
+  } else if (ts.tv_nsec < 0) {
+    --ts.tv_sec;
+    ts.tv_nsec += 1.0e9;
+  }
+}
+
+/*
+ * @brief      timespec への秒数の加算
+ *
+ * @param[in]  日時 (timespec)
+ * @param[in]  秒数 (double; 1秒未満はナノ秒へ加算)
+ * @return     日時 (timespec)
+ */
+static struct timespec add_sec(struct timespec ts, double v) {
+  int f_v = floor(v);
+
+  ts.tv_sec  += f_v;
+  ts.tv_nsec += (v - f_v) * 1.0e9;
+  norm_nsec(ts);
+
+  return ts;
+}
+
+/*
+ * @brief      timespec からの秒数の減算
+ *
+ * @param[in]  日時 (timespec)
+ * @param[in]  秒数 (double; 1秒未満はナノ秒から減算)
+ * @return     日時 (timespec)
+ */
+static struct timespec sub_sec(struct timespec ts, double v) {
+  int f_v = floor(v);
+
+  ts.tv_sec  -= f_v;
+  ts.tv_nsec -= (v - f_v) * 1.0e9;
+  norm_nsec(ts);
+
+  return ts;
+}
 
 /*
  * @brief      コンストラクタ
@@ -71,14 +167,8 @@ std::vector<std::vector<std::string>> Time::l_dut = {};  // List of DUT1
  */
 Time::Time(struct timespec ts) {
   try {
-    // うるう秒, DUT1 一覧、
-    if (l_ls.size() == 0 || l_dut.size() == 0) {
-      l_ls.reserve(50);    // 予めメモリ確保
-      l_dut.reserve(250);  // 予めメモリ確保
-      File o_f;
-      if (!o_f.get_leap_sec_list(l_ls)) throw;
-      if (!o_f.get_dut1_list(l_dut))    throw;
-    }
+    // うるう秒, DUT1 一覧
+    load_list();
     // その他の初期設定
     this->ts      = ts;
     this->ts_tai  = {};
@@ -126,6 +216,23 @@ double Time::calc_jd() {
   }
 }
 
+/*
+ * @brief       JD (ユリウス日; 2分割) 計算
+ *              * 日数部（0h; x.5）と日の端数に分割
+ *                （日の端数はナノ秒まで保持）
+ *
+ * @param[ref]  JD の日数部 (double)
+ * @param[ref]  JD の日の端数 (double)
+ * @return      <none>
+ */
+void Time::calc_jd2(double& jd_1, double& jd_2) {
+  try {
+    ts2jd(ts, jd_1, jd_2);
+  } catch (...) {
+    throw;
+  }
+}
+
 /*
  * @brief   T (ユリウス世紀数) 計算
  *
@@ -165,16 +272,16 @@ double Time::calc_dut1() { return dut1; }
  * @return  ΔT (double)
  */
 double Time::calc_dlt_t() {
-  struct tm t;
+  DateTime dt;
   int    year;  // 西暦年（対象年）
   double y;     // 西暦年（計算用）
 
   try {
     if (dlt_t != 0.0) return dlt_t;
     if (utc_tai != 0) return kTtTai - utc_tai - dut1;
-    localtime_r(&ts.tv_sec, &t);
-    year = t.tm_year + 1900;
-    y = year + (t.tm_mon + 1 - 0.5) / 12;
+    dt = ts2dt(ts);
+    year = dt.year;
+    y = year + (dt.month - 0.5) / 12;
 
     if        (                 year <  -500) {
       dlt_t = calc_dlt_t_bf_m500(y);
@@ -315,10 +422,138 @@ struct timespec Time::calc_tdb() {
   }
 }
 
+/*
+ * @brief       計算: TDB の JD, T（一括）
+ *              * 各 UTC について calc_tdb, calc_jd, calc_t と同一の値を、
+ *                Time を生成せずに計算する
+ *
+ * @param[in]   件数 (unsigned int)
+ * @param[in]   UTC 一覧 (const timespec*)
+ * @param[out]  JD 一覧 (double*; TDB)
+ * @param[out]  T 一覧 (double*; TDB)
+ * @param[out]  TDB 一覧 (timespec*; optional; nullptr: 出力しない)
+ * @return      <none>
+ */
+void Time::calc_tdb_batch(unsigned int n, const struct timespec* utcs,
+                          double* jds, double* ts, struct timespec* tdbs) {
+  try {
+    conv_tdb(n, utcs, jds, nullptr, nullptr, ts, tdbs);
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief       計算: TDB の JD（2分割）, T（一括）
+ *              * JD は日数部（0h; x.5）と日の端数に分割して出力する
+ *                （日の端数はナノ秒まで保持）
+ *              * T は分割した JD から算出する
+ *
+ * @param[in]   件数 (unsigned int)
+ * @param[in]   UTC 一覧 (const timespec*)
+ * @param[out]  JD の日数部一覧 (double*; TDB)
+ * @param[out]  JD の日の端数一覧 (double*; TDB)
+ * @param[out]  T 一覧 (double*; TDB)
+ * @param[out]  TDB 一覧 (timespec*; optional; nullptr: 出力しない)
+ * @return      <none>
+ */
+void Time::calc_tdb_batch(unsigned int n, const struct timespec* utcs,
+                          double* jd_1s, double* jd_2s, double* ts,
+                          struct timespec* tdbs) {
+  try {
+    conv_tdb(n, utcs, nullptr, jd_1s, jd_2s, ts, tdbs);
+  } catch (...) {
+    throw;
+  }
+}
+
+
 // -------------------------------------
 // 以下、 private functions
 // -------------------------------------
 
+/*
+ * @brief       計算: TDB の JD, T（一括; calc_tdb_batch 用）
+ *              * うるう秒は、入力が昇順であれば前要素の位置から進めて
+ *                求める（逆行した場合のみ二分探索）
+ *              * TDB の算出に DUT1 は不要のため参照しない
+ *
+ * @param[in]   件数 (unsigned int)
+ * @param[in]   UTC 一覧 (const timespec*)
+ * @param[out]  JD 一覧 (double*; nullptr: 2分割で出力)
+ * @param[out]  JD の日数部一覧 (double*; JD 一覧が nullptr の場合に使用)
+ * @param[out]  JD の日の端数一覧 (double*; JD 一覧が nullptr の場合に使用)
+ * @param[out]  T 一覧 (double*)
+ * @param[out]  TDB 一覧 (timespec*; nullptr: 出力しない)
+ * @return      <none>
+ */
+void Time::conv_tdb(unsigned int n, const struct timespec* utcs,
+                    double* jds, double* jd_1s, double* jd_2s, double* ts,
+                    struct timespec* tdbs) {
+  std::size_t     i_ls  = 0;  // うるう秒一覧の位置（対象日以前の件数）
+  long            day_p = 0;  // 前要素の日数
+  long            day;        // 日数
+  int             utc_tai;    // UTC - TAI
+  double          jd_utc;     // JD (UTC)
+  double          v;          // TCB - TT (s)
+  struct timespec tai;
+  struct timespec tdb;
+  unsigned int    k;
+
+  try {
+    load_list();
+    for (k = 0; k < n; ++k) {
+      // うるう秒
+      day = days_from_ts(utcs[k]);
+      if (k == 0 || day < day_p) {
+        i_ls = find_day(ls_day, day) + 1;
+      } else {
+        while (i_ls < ls_day.size() && ls_day[i_ls] <= day) { ++i_ls; }
+      }
+      day_p   = day;
+      utc_tai = (i_ls == 0) ? 0 : ls_val[i_ls - 1];
+      // UTC -> TAI -> TT -> TCB -> TDB
+      jd_utc = gc2jd(utcs[k]);
+      v      = kLB * (jd_utc - kT0) * kSecDay;
+      tai    = utcs[k];
+      tai.tv_sec -= utc_tai;
+      tdb = sub_sec(add_sec(add_sec(tai, kTtTai), v), v + kTdb0);
+      // JD, T
+      if (jds != nullptr) {
+        jds[k] = gc2jd(tdb);
+        ts[k]  = jd2t(jds[k]);
+      } else {
+        ts2jd(tdb, jd_1s[k], jd_2s[k]);
+        ts[k]  = ((jd_1s[k] - kJ2000) + jd_2s[k]) / (kJy * 100);
+      }
+      if (tdbs != nullptr) { tdbs[k] = tdb; }
+    }
+  } catch (...) {
+    throw;
+  }
+}
+
+/*
+ * @brief   うるう秒, DUT1 一覧読み込み
+ *          * 初回のみ読み込む（複数スレッドからの同時呼び出しに対応）
+ *
+ * @param   <none>
+ * @return  <none>
+ */
+void Time::load_list() {
+  std::call_once(flg_l, [] {
+    File o_f;
+    if (!o_f.get_leap_sec_list(ls_day, ls_val)
+     || !o_f.get_dut1_list(dut_day, dut_val)) {
+      ls_day.clear();
+      ls_val.clear();
+      dut_day.clear();
+      dut_val.clear();
+      throw "[ERROR] Could not read leap second / DUT1 list!";
+    }
+  });
+}
+
 /*
  * @brief      UTC (協定世界時) -> JST (日本標準時)
  *
@@ -340,42 +575,25 @@ struct timespec Time::utc2jst(struct timespec ts) {
 
 /*
  * @brief      GC (グレゴリオ暦) -> JD (ユリウス日)
+ *             * 日付部分は 1970-01-01 からの通日より算出
+ *               （年月日の算出は不要; 紀元前の日付も正しく扱う）
  *
  * @param[in]  GC (timespec)
  * @return     JD (double)
  */
 double Time::gc2jd(struct timespec ts) {
-  struct tm t;
-  unsigned int year;
-  unsigned int month;
-  unsigned int day;
-  unsigned int hour;
-  unsigned int min;
-  unsigned int sec;
+  long days;  // 日数（1970-01-01 からの通日）
+  long secs;  // 日内の秒数
   double jd;
 
   try {
-    localtime_r(&ts.tv_sec, &t);
-    year  = t.tm_year + 1900;
-    month = t.tm_mon + 1;
-    day   = t.tm_mday;
-    hour  = t.tm_hour;
-    min   = t.tm_min;
-    sec   = t.tm_sec;
-    // 1月,2月は前年の13月,14月とする
-    if (month < 3) {
-      --year;
-      month += 12;
-    }
-    // 日付(整数)部分
-    jd = static_cast<int>(365.25 * year)
-       + static_cast<int>(year / 400.0)
-       - static_cast<int>(year / 100.0)
-       + static_cast<int>(30.59 * (month - 2))
-       + day
-       + 1721088.5;
+    days = days_from_ts(ts);
+    secs = ts.tv_sec - days * kSecDay;
+    // 日付(整数)部分（0h の JD; 暦日への変換は不要）
+    jd = days + 2440587.5;
     // 時間(小数)部分
-    jd += (sec / 3600.0 + min / 60.0 + hour) / 24.0;
+    jd += (secs % 60 / 3600.0 + secs % 3600 / 60 / 60.0 + secs / 3600)
+        / 24.0;
     // 時間(ナノ秒)部分
     jd += ts.tv_nsec / 1000000000.0 / 3600.0 / 24.0;
   } catch (...) {
@@ -410,76 +628,35 @@ double Time::jd2t(double jd_a) {
  * @return      UTC - TAI (int)
  */
 int Time::get_utc_tai(struct timespec ts) {
-  struct tm t;
-  std::stringstream ss;      // 対象年月日算出用
-  std::string dt_t;          // 対象年月日
-  std::string buf;           // 1行分バッファ
-  int i;                     // ループインデックス
-  utc_tai = 0;               // 初期化
+  long i;  // インデックス
 
   try {
-    // 対象年月日
-    localtime_r(&ts.tv_sec, &t);
-    ss << std::setw(4) << std::setfill('0') << std::right
-       << t.tm_year + 1900
-       << std::setw(2) << std::setfill('0') << std::right
-       << t.tm_mon + 1
-       << std::setw(2) << std::setfill('0') << std::right
-       << t.tm_mday;
-    dt_t = ss.str();
-
-    // うるう秒取得
-    for (i = l_ls.size() - 1; i >= 0; --i) {
-      if (l_ls[i][0] <= dt_t) {
-        utc_tai = stoi(l_ls[i][1]);
-        break;
-      }
-    }
-
-    return utc_tai;
+    i = find_day(ls_day, days_from_ts(ts));
+    utc_tai = (i < 0) ? 0 : ls_val[i];
   } catch (...) {
     throw;
   }
+
+  return utc_tai;
 }
 
 /*
  * @brief       DUT1 (UT1(世界時1) と UTC(協定世界時)の差) 取得
  *
- * @param[ref]  DUT1 一覧
  * @param[in]   UTC (timespec)
  * @return      DUT1 (double)
  */
 double Time::get_dut1(struct timespec ts) {
-  struct tm t;
-  std::stringstream ss;    // 対象年月日算出用
-  std::string dt_t;        // 対象年月日
-  std::string buf;         // 1行分バッファ
-  int i;                   // ループインデックス
-  dut1 = 0.0;              // 初期化
+  long i;  // インデックス
 
   try {
-    // 対象年月日
-    localtime_r(&ts.tv_sec, &t);
-    ss << std::setw(4) << std::setfill('0') << std::right
-       << t.tm_year + 1900
-       << std::setw(2) << std::setfill('0') << std::right
-       << t.tm_mon + 1
-       << std::setw(2) << std::setfill('0') << std::right
-       << t.tm_mday;
-    dt_t = ss.str();
-
-    // DUT1 取得
-    for (i = l_dut.size() - 1; i >= 0; --i) {
-      if (l_dut[i][0] <= dt_t) {
-        dut1 = stod(l_dut[i][1]);
-        break;
-      }
-    }
-
-    return dut1;
+    i = find_day(dut_day, days_from_ts(ts));
+    dut1 = (i < 0) ? 0.0 : dut_val[i];
   } catch (...) {
     throw;
   }
+
+  return dut1;
 }
 
 /*
@@ -530,19 +707,8 @@ struct timespec Time::utc2ut1(struct timespec ts) {
  * @return     TT (timespec)
  */
 struct timespec Time::tai2tt(struct timespec ts) {
-  int f_tt_tai;
-
   try {
-    f_tt_tai = floor(kTtTai);
-    ts_tt.tv_sec  = ts.tv_sec + f_tt_tai;
-    ts_tt.tv_nsec = ts.tv_nsec + (kTtTai - f_tt_tai) * 1.0e9;
-    if (ts_tt.tv_nsec > 1.0e9) {
-      ++ts_tt.tv_sec;
-      ts_tt.tv_nsec -= 1.0e9;
-    } else if (ts_tt.tv_nsec < 0) {
-      --ts_tt.tv_sec;
-      ts_tt.tv_nsec += 1.0e9;
-    }
+    ts_tt = add_sec(ts, kTtTai);
   } catch (...) {
     throw;
   }
@@ -557,21 +723,8 @@ struct timespec Time::tai2tt(struct timespec ts) {
  * @return     TCG (timespec)
  */
 struct timespec Time::tt2tcg(struct timespec ts) {
-  double v;
-  int    f_v;
-
   try {
-    v = kLG * (jd - kT0) * kSecDay;
-    f_v = floor(v);
-    ts_tcg.tv_sec  = ts.tv_sec + f_v;
-    ts_tcg.tv_nsec = ts.tv_nsec + (v - f_v) * 1.0e9;
-    if (ts_tcg.tv_nsec > 1.0e9) {
-      ++ts_tcg.tv_sec;
-      ts_tcg.tv_nsec -= 1.0e9;
-    } else if (ts_tcg.tv_nsec < 0) {
-      --ts_tcg.tv_sec;
-      ts_tcg.tv_nsec += 1.0e9;
-    }
+    ts_tcg = add_sec(ts, kLG * (jd - kT0) * kSecDay);
   } catch (...) {
     throw;
   }
@@ -586,21 +739,8 @@ struct timespec Time::tt2tcg(struct timespec ts) {
  * @return     TCB (timespec)
  */
 struct timespec Time::tt2tcb(struct timespec ts) {
-  double v;
-  int    f_v;
-
   try {
-    v = kLB * (jd - kT0) * kSecDay;
-    f_v = floor(v);
-    ts_tcb.tv_sec  = ts.tv_sec + f_v;
-    ts_tcb.tv_nsec = ts.tv_nsec + (v - f_v) * 1.0e9;
-    if (ts_tcb.tv_nsec > 1.0e9) {
-      ++ts_tcg.tv_sec;
-      ts_tcb.tv_nsec -= 1.0e9;
-    } else if (ts_tcb.tv_nsec < 0) {
-      --ts_tcb.tv_sec;
-      ts_tcb.tv_nsec += 1.0e9;
-    }
+    ts_tcb = add_sec(ts, kLB * (jd - kT0) * kSecDay);
   } catch (...) {
     throw;
   }
@@ -615,21 +755,8 @@ struct timespec Time::tt2tcb(struct timespec ts) {
  * @return     TDB (timespec)
  */
 struct timespec Time::tcb2tdb(struct timespec ts) {
-  double v;
-  int    f_v;
-
   try {
-    v = kLB * (jd - kT0) * kSecDay + kTdb0;
-    f_v = floor(v);
-    ts_tdb.tv_sec  = ts.tv_sec - f_v;
-    ts_tdb.tv_nsec = ts.tv_nsec - (v - f_v) * 1.0e9;
-    if (ts_tdb.tv_nsec > 1.0e9) {
-      ++ts_tcg.tv_sec;
-      ts_tdb.tv_nsec -= 1.0e9;
-    } else if (ts_tdb.tv_nsec < 0) {
-      --ts_tdb.tv_sec;
-      ts_tdb.tv_nsec += 1.0e9;
-    }
+    ts_tdb = sub_sec(ts, kLB * (jd - kT0) * kSecDay + kTdb0);
   } catch (...) {
     throw;
   }
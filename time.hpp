@@ -1,6 +1,7 @@
 #ifndef APPARENT_SUN_MOON_TIME_HPP_
 #define APPARENT_SUN_MOON_TIME_HPP_
 
+#include "calendar.hpp"
 #include "delta_t.hpp"
 #include "file.hpp"
 
@@ -8,6 +9,7 @@
 #include <ctime>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -15,11 +17,15 @@
 namespace apparent_sun_moon {
 
 struct timespec jst2utc(struct timespec);   // 変換: JST -> UTC
+struct timespec utc2jst(struct timespec);   // 変換: UTC -> JST
 std::string gen_time_str(struct timespec);  // 日時文字列生成
 
 class Time {
-  static std::vector<std::vector<std::string>> l_ls;   // List of Leap Second
-  static std::vector<std::vector<std::string>> l_dut;  // List of DUT1
+  static std::vector<long>   ls_day;   // List of Leap Second（適用開始日の日数）
+  static std::vector<int>    ls_val;   // List of Leap Second（UTC - TAI）
+  static std::vector<long>   dut_day;  // List of DUT1（適用開始日の日数）
+  static std::vector<double> dut_val;  // List of DUT1（DUT1）
+  static std::once_flag      flg_l;    // 一覧読み込み用
   struct timespec ts;      // timespec of UTC
   struct timespec ts_tai;  // timespec of TAI
   struct timespec ts_ut1;  // timespec of UT1
@@ -37,6 +43,8 @@ public:
   Time(struct timespec);       // コンストラクタ
   struct timespec calc_jst();  // 計算: JST  (日本標準時)
   double calc_jd();            // 計算: JD   (ユリウス日)
+  void   calc_jd2(double&, double&);
+                               // 計算: JD   (ユリウス日; 日数部, 日の端数)
   double calc_t();             // 計算: T    (ユリウス世紀数)
   int    calc_utc_tai();       // 計算: UTC - TAI (協定世界時と国際原子時の差 = うるう秒の総和)
   double calc_dut1();          // 計算: DUT1 (UT1(世界時1) と UTC(協定世界時)の差)
@@ -47,11 +55,22 @@ public:
   struct timespec calc_tcg();  // 計算: TCG  (地球重心座標時)
   struct timespec calc_tcb();  // 計算: TCB  (太陽系重心座標時)
   struct timespec calc_tdb();  // 計算: TDB  (太陽系力学時)
+  static void calc_tdb_batch(unsigned int, const struct timespec*,
+                             double*, double*, struct timespec* = nullptr);
+                               // 計算: TDB の JD, T（一括）
+  static void calc_tdb_batch(unsigned int, const struct timespec*,
+                             double*, double*, double*,
+                             struct timespec* = nullptr);
+                               // 計算: TDB の JD（2分割）, T（一括）
 
 private:
+  static void load_list();                   // うるう秒, DUT1 一覧読み込み（初回のみ）
+  static void conv_tdb(unsigned int, const struct timespec*, double*,
+                       double*, double*, double*, struct timespec*);
+                                             // 計算: TDB の JD, T（一括; calc_tdb_batch 用）
   struct timespec utc2jst(struct timespec);  // UTC -> JST
-  double gc2jd(struct timespec);             // GC  -> JD
-  double jd2t(double);                       // JD  -> T
+  static double gc2jd(struct timespec);      // GC  -> JD
+  static double jd2t(double);                // JD  -> T
   int    get_utc_tai(struct timespec);       // UTC -> UTC - TAI
   double get_dut1(struct timespec);          // UTC -> DUT1
   struct timespec utc2tai(struct timespec);  // UTC -> TAI